@@ -0,0 +1,139 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "arena.h"
+#include <atomic>
+#include <new>
+
+namespace privmx {
+    namespace wrapper {
+        namespace {
+            constexpr size_t BLOCK_SIZE = 16 * 1024;
+
+            std::atomic<uint64_t> allocationsCounter{0};
+            std::atomic<uint64_t> allocatedBytesCounter{0};
+            std::atomic<uint64_t> blockAllocationsCounter{0};
+            std::atomic<uint64_t> unscopedAllocationsCounter{0};
+        }
+
+        struct alignas(std::max_align_t) CallArena::Block {
+            Block *next;
+            size_t capacity;
+
+            char *data() { return reinterpret_cast<char *>(this + 1); }
+
+            const char *data() const { return reinterpret_cast<const char *>(this + 1); }
+        };
+
+        CallArena::Scope::Scope()
+                : _arena(CallArena::current()), _block(_arena._current), _offset(_arena._offset) {
+            _arena._depth++;
+        }
+
+        CallArena::Scope::~Scope() {
+            _arena._depth--;
+            _arena.rewind(static_cast<Block *>(_block), _offset);
+        }
+
+        CallArena &CallArena::current() {
+            static thread_local CallArena arena;
+            return arena;
+        }
+
+        void *CallArena::allocate(size_t size, size_t alignment) {
+            if (_depth == 0) {
+                unscopedAllocationsCounter.fetch_add(1, std::memory_order_relaxed);
+                return ::operator new(size);
+            }
+            if (_current != nullptr) {
+                size_t aligned = (_offset + alignment - 1) & ~(alignment - 1);
+                if (aligned + size <= _current->capacity) {
+                    _offset = aligned + size;
+                    allocationsCounter.fetch_add(1, std::memory_order_relaxed);
+                    allocatedBytesCounter.fetch_add(size, std::memory_order_relaxed);
+                    return _current->data() + aligned;
+                }
+            }
+            size_t capacity = size + alignment > BLOCK_SIZE ? size + alignment : BLOCK_SIZE;
+            Block *block = static_cast<Block *>(::operator new(sizeof(Block) + capacity));
+            block->next = nullptr;
+            block->capacity = capacity;
+            blockAllocationsCounter.fetch_add(1, std::memory_order_relaxed);
+            if (_current == nullptr) {
+                _head = block;
+            } else {
+                _current->next = block;
+            }
+            _current = block;
+            _offset = 0;
+            return allocate(size, alignment);
+        }
+
+        void CallArena::deallocate(void *ptr) {
+            // Arena memory is released by Scope, only heap fallbacks are freed here
+            if (ptr != nullptr && !owns(ptr)) {
+                ::operator delete(ptr);
+            }
+        }
+
+        bool CallArena::owns(const void *ptr) const {
+            auto address = static_cast<const char *>(ptr);
+            for (Block *block = _head; block != nullptr; block = block->next) {
+                if (address >= block->data() && address < block->data() + block->capacity) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void CallArena::rewind(Block *block, size_t offset) {
+            // The first block is kept for the next calls on this thread
+            Block *last = block != nullptr ? block : _head;
+            if (last == nullptr) {
+                return;
+            }
+            Block *next = last->next;
+            while (next != nullptr) {
+                Block *toFree = next;
+                next = next->next;
+                ::operator delete(toFree);
+            }
+            last->next = nullptr;
+            _current = last;
+            _offset = block != nullptr ? offset : 0;
+        }
+
+        CallArena::Stats CallArena::stats() {
+            return Stats{
+                    allocationsCounter.load(std::memory_order_relaxed),
+                    allocatedBytesCounter.load(std::memory_order_relaxed),
+                    blockAllocationsCounter.load(std::memory_order_relaxed),
+                    unscopedAllocationsCounter.load(std::memory_order_relaxed)
+            };
+        }
+
+        void CallArena::resetStats() {
+            allocationsCounter.store(0, std::memory_order_relaxed);
+            allocatedBytesCounter.store(0, std::memory_order_relaxed);
+            blockAllocationsCounter.store(0, std::memory_order_relaxed);
+            unscopedAllocationsCounter.store(0, std::memory_order_relaxed);
+        }
+
+        CallArena::~CallArena() {
+            Block *block = _head;
+            while (block != nullptr) {
+                Block *next = block->next;
+                ::operator delete(block);
+                block = next;
+            }
+        }
+    } // wrapper
+} // privmx
@@ -0,0 +1,119 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef PRIVMXENDPOINTWRAPPER_ARENA_H
+#define PRIVMXENDPOINTWRAPPER_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace privmx {
+    namespace wrapper {
+        /**
+         * Thread-local bump allocator for temporaries of a single JNI call.
+         * Memory allocated inside a Scope is released at once when the Scope ends;
+         * blocks are kept between calls, so in steady state the arena itself does not touch the heap.
+         * Allocations made outside any Scope are served from the heap.
+         * Only temporaries allocated through the arena are covered; std::string, std::vector and
+         * other temporaries of entry points using the default allocator still go to the general heap.
+         */
+        class CallArena {
+        public:
+            // Counters of arena activity only, general heap allocations are not counted
+            struct Stats {
+                // Allocations served from arena blocks
+                uint64_t allocations;
+                uint64_t allocatedBytes;
+                // Arena blocks requested from the heap
+                uint64_t blockAllocations;
+                // Arena allocations made outside of any Scope, served from the heap
+                uint64_t unscopedAllocations;
+            };
+
+            class Scope {
+            public:
+                Scope();
+
+                ~Scope();
+
+                Scope(const Scope &) = delete;
+
+                Scope &operator=(const Scope &) = delete;
+
+            private:
+                CallArena &_arena;
+                void *_block;
+                size_t _offset;
+            };
+
+            static CallArena &current();
+
+            void *allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+            void deallocate(void *ptr);
+
+            template<typename T>
+            T *allocateArray(size_t count) {
+                return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+            }
+
+            static Stats stats();
+
+            static void resetStats();
+
+            ~CallArena();
+
+        private:
+            struct Block;
+
+            CallArena() = default;
+
+            bool owns(const void *ptr) const;
+
+            void rewind(Block *block, size_t offset);
+
+            Block *_head = nullptr;
+            Block *_current = nullptr;
+            size_t _offset = 0;
+            int _depth = 0;
+        };
+
+        /**
+         * Allocator for standard containers backed by the current thread's CallArena.
+         */
+        template<typename T>
+        class ArenaAllocator {
+        public:
+            using value_type = T;
+
+            ArenaAllocator() = default;
+
+            template<typename U>
+            ArenaAllocator(const ArenaAllocator<U> &) {}
+
+            T *allocate(size_t count) {
+                return CallArena::current().allocateArray<T>(count);
+            }
+
+            void deallocate(T *ptr, size_t) {
+                CallArena::current().deallocate(ptr);
+            }
+
+            template<typename U>
+            bool operator==(const ArenaAllocator<U> &) const { return true; }
+
+            template<typename U>
+            bool operator!=(const ArenaAllocator<U> &) const { return false; }
+        };
+    } // wrapper
+} // privmx
+
+#endif //PRIVMXENDPOINTWRAPPER_ARENA_H
@@ -0,0 +1,87 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "bulk.h"
+#include <exception>
+#include <unordered_set>
+#include <vector>
+#include "utils.hpp"
+#include "executor.h"
+
+namespace privmx {
+    namespace wrapper {
+        bool jList2ids(JniContextUtils &ctx, jobject ids, std::vector<std::string> &values) {
+            jobjectArray idsArray = ctx.jObject2jArray(ids);
+            if (idsArray == nullptr) {
+                return false;
+            }
+            jsize size = ctx->GetArrayLength(idsArray);
+            values.reserve(values.size() + size);
+            for (jsize i = 0; i < size; ++i) {
+                auto id = (jstring) ctx->GetObjectArrayElement(idsArray, i);
+                if (ctx.nullCheck(id, "ID")) {
+                    return false;
+                }
+                values.push_back(ctx.jString2string(id));
+                ctx->DeleteLocalRef(id);
+            }
+            ctx->DeleteLocalRef(idsArray);
+            return true;
+        }
+
+        jobject forEachIdParallel(
+                JniContextUtils &ctx,
+                jobject ids,
+                const std::function<void(const std::string &)> &call
+        ) {
+            std::vector<std::string> allValues;
+            if (!jList2ids(ctx, ids, allValues)) {
+                return nullptr;
+            }
+            std::vector<std::string> values;
+            values.reserve(allValues.size());
+            std::unordered_set<std::string> seen;
+            for (auto &value: allValues) {
+                if (seen.insert(value).second) {
+                    values.push_back(std::move(value));
+                }
+            }
+
+            std::vector<std::exception_ptr> errors(values.size());
+            runParallel(values.size(), BULK_MAX_THREADS, [&values, &errors, &call](size_t i) {
+                try {
+                    call(values[i]);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+
+            jclass mapCls = ctx->FindClass("java/util/HashMap");
+            jmethodID initMID = ctx->GetMethodID(mapCls, "<init>", "()V");
+            jmethodID putMID = ctx->GetMethodID(
+                    mapCls, "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+            jobject result = ctx->NewObject(mapCls, initMID);
+            for (size_t i = 0; i < values.size(); ++i) {
+                if (!errors[i]) {
+                    continue;
+                }
+                jstring key = ctx.string2jString(values[i]);
+                jthrowable exception = ctx.exception2jthrowable(errors[i]);
+                jobject previous = ctx->CallObjectMethod(result, putMID, key, exception);
+                ctx->DeleteLocalRef(previous);
+                ctx->DeleteLocalRef(exception);
+                ctx->DeleteLocalRef(key);
+            }
+            ctx->DeleteLocalRef(mapCls);
+            return result;
+        }
+    } // wrapper
+} // privmx
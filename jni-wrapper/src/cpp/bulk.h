@@ -0,0 +1,48 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef PRIVMXENDPOINTWRAPPER_BULK_H
+#define PRIVMXENDPOINTWRAPPER_BULK_H
+
+#include <jni.h>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+class JniContextUtils;
+
+namespace privmx {
+    namespace wrapper {
+        // Requests sent at once within a single bulk call
+        constexpr size_t BULK_MAX_THREADS = 16;
+
+        /**
+         * Reads IDs from java.util.List<String> into values.
+         * Returns false when a Java exception is pending (e.g. the list contains null).
+         */
+        bool jList2ids(JniContextUtils &ctx, jobject ids, std::vector<std::string> &values);
+
+        /**
+         * Calls given function once for each distinct ID from java.util.List<String>,
+         * running up to BULK_MAX_THREADS calls at once.
+         * Returns java.util.Map from IDs whose call failed to the matching Java exceptions,
+         * or nullptr when a Java exception is pending (e.g. the list contains null).
+         */
+        jobject forEachIdParallel(
+                JniContextUtils &ctx,
+                jobject ids,
+                const std::function<void(const std::string &)> &call
+        );
+    } // wrapper
+} // privmx
+
+#endif //PRIVMXENDPOINTWRAPPER_BULK_H
@@ -0,0 +1,232 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "cancellation.h"
+#include <condition_variable>
+#include <queue>
+#include <thread>
+#include "utils.hpp"
+#include "jniUtils.h"
+#include "exceptions.h"
+
+namespace privmx {
+    namespace wrapper {
+        namespace {
+            constexpr jint EXPIRE_LOCAL_REFS = 16;
+
+            /**
+             * Single thread expiring cancellation states when their deadlines pass.
+             * Holds weak references, so freed tokens are skipped.
+             */
+            class DeadlineTimer {
+            public:
+                static DeadlineTimer &instance() {
+                    // Never destroyed, same as the executor threads
+                    static DeadlineTimer *timer = new DeadlineTimer();
+                    return *timer;
+                }
+
+                void schedule(JavaVM *javaVM,
+                              CancellationState::Clock::time_point deadline,
+                              std::weak_ptr<CancellationState> state) {
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _javaVM = javaVM;
+                        _entries.push(Entry{deadline, std::move(state)});
+                    }
+                    _changed.notify_one();
+                }
+
+            private:
+                struct Entry {
+                    CancellationState::Clock::time_point deadline;
+                    std::weak_ptr<CancellationState> state;
+
+                    bool operator>(const Entry &other) const {
+                        return deadline > other.deadline;
+                    }
+                };
+
+                DeadlineTimer() : _javaVM(nullptr) {
+                    std::thread(&DeadlineTimer::run, this).detach();
+                }
+
+                void run() {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    while (true) {
+                        if (_entries.empty()) {
+                            _changed.wait(lock);
+                            continue;
+                        }
+                        auto deadline = _entries.top().deadline;
+                        if (CancellationState::Clock::now() < deadline) {
+                            _changed.wait_until(lock, deadline);
+                            continue;
+                        }
+                        auto state = _entries.top().state.lock();
+                        _entries.pop();
+                        if (state == nullptr) {
+                            continue;
+                        }
+                        JavaVM *javaVM = _javaVM;
+                        lock.unlock();
+                        expire(javaVM, *state);
+                        lock.lock();
+                    }
+                }
+
+                static void expire(JavaVM *javaVM, CancellationState &state) {
+                    JNIEnv *env = jni::AttachCurrentThreadIfNeeded(
+                            javaVM,
+                            jni::getPrivmxExecutorThreadName(),
+                            nullptr,
+                            true);
+                    if (env == nullptr) {
+                        return;
+                    }
+                    JniContextUtils ctx(env);
+                    JniContextUtils::LocalFrame frame(ctx, EXPIRE_LOCAL_REFS);
+                    state.expire(ctx);
+                }
+
+                std::mutex _mutex;
+                std::condition_variable _changed;
+                std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> _entries;
+                JavaVM *_javaVM;
+            };
+        }
+
+        std::shared_ptr<CancellationState> CancellationState::create(
+                JniContextUtils &ctx,
+                jclass contextClass,
+                std::optional<Clock::time_point> deadline
+        ) {
+            std::shared_ptr<CancellationState> state(
+                    new CancellationState((jclass) ctx->NewGlobalRef(contextClass), deadline));
+            if (deadline.has_value()) {
+                JavaVM *javaVM = nullptr;
+                ctx->GetJavaVM(&javaVM);
+                DeadlineTimer::instance().schedule(javaVM, deadline.value(), state);
+            }
+            return state;
+        }
+
+        CancellationState::CancellationState(jclass contextClass, std::optional<Clock::time_point> deadline)
+                : _state(ACTIVE), _deadline(deadline), _contextClass(contextClass) {}
+
+        // Global references are released in release(), which has access to JNIEnv
+        CancellationState::~CancellationState() = default;
+
+        // A released token no longer cancels calls, even when its deadline passes
+        bool CancellationState::isCancelled() const {
+            int state = _state.load();
+            return state == CANCELLED || state == DEADLINE_EXCEEDED ||
+                   (state == ACTIVE && _deadline.has_value() && Clock::now() >= _deadline.value());
+        }
+
+        bool CancellationState::deadlineExceeded() const {
+            int state = _state.load();
+            return state == DEADLINE_EXCEEDED ||
+                   (state == ACTIVE && _deadline.has_value() && Clock::now() >= _deadline.value());
+        }
+
+        bool CancellationState::registerFuture(JniContextUtils &ctx, jobject future) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (isCancelled()) {
+                return false;
+            }
+            if (_state.load() == RELEASED) {
+                // Nothing would complete or delete the reference, the call just runs to its end
+                return true;
+            }
+            _futures.push_back(ctx->NewGlobalRef(future));
+            return true;
+        }
+
+        void CancellationState::unregisterFuture(JniContextUtils &ctx, jobject future) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto it = _futures.begin(); it != _futures.end(); ++it) {
+                if (ctx->IsSameObject(*it, future)) {
+                    ctx->DeleteGlobalRef(*it);
+                    _futures.erase(it);
+                    return;
+                }
+            }
+        }
+
+        void CancellationState::cancel(JniContextUtils &ctx) {
+            finish(ctx, CANCELLED);
+        }
+
+        void CancellationState::expire(JniContextUtils &ctx) {
+            finish(ctx, DEADLINE_EXCEEDED);
+        }
+
+        void CancellationState::release(JniContextUtils &ctx) {
+            std::vector<jobject> futures;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _state.store(RELEASED);
+                futures.swap(_futures);
+            }
+            for (jobject future: futures) {
+                ctx->DeleteGlobalRef(future);
+            }
+            ctx->DeleteGlobalRef(_contextClass);
+        }
+
+        void CancellationState::finish(JniContextUtils &ctx, State state) {
+            std::vector<jobject> futures;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                int expected = ACTIVE;
+                if (!_state.compare_exchange_strong(expected, state)) {
+                    return;
+                }
+                futures.swap(_futures);
+                // Under the lock, as release() may delete the class reference right after
+                ctx.setClassLoaderFromClass(_contextClass);
+            }
+            for (jobject future: futures) {
+                ctx.failFuture(future, std::make_exception_ptr(
+                        CallCancelledException(state == DEADLINE_EXCEEDED)));
+                ctx->DeleteGlobalRef(future);
+            }
+        }
+
+        std::shared_ptr<CancellationState> getCancellationState(JniContextUtils &ctx, jobject token) {
+            if (token == nullptr) {
+                return nullptr;
+            }
+            // CancellationToken.close is synchronized on the token, so holding its monitor keeps
+            // the holder from being freed until the shared pointer is copied
+            struct MonitorGuard {
+                JniContextUtils &ctx;
+                jobject obj;
+                ~MonitorGuard() { ctx->MonitorExit(obj); }
+            };
+            if (ctx->MonitorEnter(token) != JNI_OK) {
+                throw IllegalStateException("Cannot lock CancellationToken");
+            }
+            MonitorGuard guard{ctx, token};
+            jclass cls = ctx->GetObjectClass(token);
+            jfieldID tokenFID = ctx->GetFieldID(cls, "token", "Ljava/lang/Long;");
+            jobject tokenLong = ctx->GetObjectField(token, tokenFID);
+            ctx->DeleteLocalRef(cls);
+            if (tokenLong == nullptr) {
+                throw IllegalStateException("This CancellationToken instance cannot be used anymore");
+            }
+            auto state = (std::shared_ptr<CancellationState> *) ctx.getObject(tokenLong).getLongValue();
+            ctx->DeleteLocalRef(tokenLong);
+            return *state;
+        }
+    } // wrapper
+} // privmx
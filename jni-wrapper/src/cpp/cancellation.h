@@ -0,0 +1,96 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef PRIVMXENDPOINTWRAPPER_CANCELLATION_H
+#define PRIVMXENDPOINTWRAPPER_CANCELLATION_H
+
+#include <jni.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+class JniContextUtils;
+
+namespace privmx {
+    namespace wrapper {
+        /**
+         * Native state of a CancellationToken, shared with async calls using it.
+         * Futures of calls in progress are registered in the state and completed with
+         * CallCancelledException as soon as the token is cancelled or its deadline passes,
+         * while the endpoint call itself finishes in the background and its result is dropped.
+         */
+        class CancellationState {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            static std::shared_ptr<CancellationState> create(
+                    JniContextUtils &ctx,
+                    jclass contextClass,
+                    std::optional<Clock::time_point> deadline);
+
+            ~CancellationState();
+
+            bool isCancelled() const;
+
+            bool deadlineExceeded() const;
+
+            /**
+             * Registers future of a call in progress.
+             * Returns false, without registering, when the state is already cancelled.
+             * Futures are not registered in a released state, which never cancels calls.
+             */
+            bool registerFuture(JniContextUtils &ctx, jobject future);
+
+            void unregisterFuture(JniContextUtils &ctx, jobject future);
+
+            void cancel(JniContextUtils &ctx);
+
+            /**
+             * Completes registered futures when the deadline passed, called by the deadline timer.
+             */
+            void expire(JniContextUtils &ctx);
+
+            /**
+             * Drops registered futures without completing them, when the token is freed.
+             * Calls in progress are no longer cancelled, neither by cancel() nor by the deadline.
+             */
+            void release(JniContextUtils &ctx);
+
+        private:
+            enum State {
+                ACTIVE, CANCELLED, DEADLINE_EXCEEDED, RELEASED
+            };
+
+            CancellationState(jclass contextClass, std::optional<Clock::time_point> deadline);
+
+            void finish(JniContextUtils &ctx, State state);
+
+            std::atomic<int> _state;
+            const std::optional<Clock::time_point> _deadline;
+            // Global reference to the token class, its class loader is used to create exceptions
+            jclass _contextClass;
+            std::mutex _mutex;
+            // Global references to futures of calls in progress
+            std::vector<jobject> _futures;
+        };
+
+        /**
+         * Returns state of given CancellationToken or nullptr when token is null.
+         * Throws IllegalStateException when the token is closed.
+         */
+        std::shared_ptr<CancellationState> getCancellationState(JniContextUtils &ctx, jobject token);
+    } // wrapper
+} // privmx
+
+#endif //PRIVMXENDPOINTWRAPPER_CANCELLATION_H
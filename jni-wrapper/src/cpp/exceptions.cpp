@@ -19,4 +19,14 @@ const char *IllegalStateException::what() const noexcept {
     return this->message;
 }
 
+CallCancelledException::CallCancelledException(bool deadlineExceeded) {
+    this->deadline = deadlineExceeded;
+}
+
+bool CallCancelledException::deadlineExceeded() const {
+    return this->deadline;
+}
 
+const char *CallCancelledException::what() const noexcept {
+    return this->deadline ? "Call deadline exceeded" : "Call cancelled";
+}
@@ -22,4 +22,13 @@ public:
     const char* what() const noexcept override;
 };
 
+class CallCancelledException: public std::exception {
+private:
+    bool deadline;
+public:
+    CallCancelledException(bool deadlineExceeded);
+    bool deadlineExceeded() const;
+    const char* what() const noexcept override;
+};
+
 #endif //PRIVMXENDPOINTWRAPPER_EXCEPTIONS_H
@@ -0,0 +1,101 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "executor.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace privmx {
+    namespace wrapper {
+        namespace {
+            // Tasks block on network I/O most of the time, so the pool is larger than the number of cores
+            constexpr size_t MIN_THREADS = 4;
+            constexpr size_t THREADS_PER_CORE = 2;
+        }
+
+        NativeExecutor &NativeExecutor::instance() {
+            // Never destroyed: worker threads are attached to JVM and must not be joined during exit
+            static NativeExecutor *executor = new NativeExecutor(
+                    std::max(MIN_THREADS, THREADS_PER_CORE * std::thread::hardware_concurrency()));
+            return *executor;
+        }
+
+        NativeExecutor &NativeExecutor::compute() {
+            static NativeExecutor *executor = new NativeExecutor(
+                    std::max<size_t>(1, std::thread::hardware_concurrency()));
+            return *executor;
+        }
+
+        NativeExecutor::NativeExecutor(size_t threadCount) {
+            for (size_t i = 0; i < threadCount; ++i) {
+                std::thread(&NativeExecutor::run, this).detach();
+            }
+        }
+
+        void NativeExecutor::submit(std::function<void()> task) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _tasks.push_back(std::move(task));
+            }
+            _available.notify_one();
+        }
+
+        void NativeExecutor::run() {
+            while (true) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _available.wait(lock, [this]() { return !_tasks.empty(); });
+                    task = std::move(_tasks.front());
+                    _tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        void runParallel(size_t count, size_t maxThreads, const std::function<void(size_t)> &task) {
+            std::atomic<size_t> next{0};
+            auto worker = [&next, &count, &task]() {
+                for (size_t i = next++; i < count; i = next++) {
+                    task(i);
+                }
+            };
+            std::vector<std::thread> threads;
+            size_t threadCount = std::min(count, maxThreads);
+            // Reserved up front, so adding a thread never reallocates after the first one started
+            threads.reserve(threadCount > 0 ? threadCount - 1 : 0);
+            try {
+                for (size_t i = 1; i < threadCount; ++i) {
+                    threads.emplace_back(worker);
+                }
+            } catch (const std::system_error &) {
+                // Thread limit reached, the calling thread and threads already started do the rest
+            }
+            std::exception_ptr error;
+            try {
+                worker();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            // Threads reference locals of this function, so they are joined on every path
+            for (auto &thread: threads) {
+                thread.join();
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    } // wrapper
+} // privmx
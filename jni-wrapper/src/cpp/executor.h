@@ -0,0 +1,64 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef PRIVMXENDPOINTWRAPPER_EXECUTOR_H
+#define PRIVMXENDPOINTWRAPPER_EXECUTOR_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace privmx {
+    namespace wrapper {
+        /**
+         * Fixed pool of native threads running blocking endpoint calls for async JNI methods.
+         * Threads are started on first use and live until the process exits;
+         * tasks submitted while all threads are busy wait in FIFO order.
+         */
+        class NativeExecutor {
+        public:
+            static NativeExecutor &instance();
+
+            /**
+             * Pool with one thread per core for CPU-bound tasks such as key derivation,
+             * so they do not hold threads of instance() needed by network calls.
+             */
+            static NativeExecutor &compute();
+
+            void submit(std::function<void()> task);
+
+            NativeExecutor(const NativeExecutor &) = delete;
+
+            NativeExecutor &operator=(const NativeExecutor &) = delete;
+
+        private:
+            explicit NativeExecutor(size_t threadCount);
+
+            void run();
+
+            std::mutex _mutex;
+            std::condition_variable _available;
+            std::deque<std::function<void()>> _tasks;
+        };
+
+        /**
+         * Runs task for indexes from 0 to count - 1 on the calling thread and at most maxThreads - 1
+         * additional threads, returning when all indexes are done. Task must not throw.
+         * When threads cannot be created, fewer of them are used; the calling thread always takes part.
+         * Uses its own threads, so it may be called from NativeExecutor tasks without starving the pool.
+         */
+        void runParallel(size_t count, size_t maxThreads, const std::function<void(size_t)> &task);
+    } // wrapper
+} // privmx
+
+#endif //PRIVMXENDPOINTWRAPPER_EXECUTOR_H
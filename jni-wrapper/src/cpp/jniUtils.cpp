@@ -17,7 +17,8 @@ namespace privmx {
             JNIEnv *AttachCurrentThreadIfNeeded(
                     JavaVM *javaVM,
                     std::string shortThreadName,
-                    jobject threadGroup
+                    jobject threadGroup,
+                    bool daemon
             ) {
                 JNIEnv *jni = nullptr;
                 jint status = javaVM->GetEnv((void **) &jni, JNI_VERSION_1_6);
@@ -40,7 +41,10 @@ namespace privmx {
                 JNIEnv *env = nullptr;
 #endif
 
-                if (javaVM->AttachCurrentThread(&env, &args) == JNI_OK) {
+                jint attached = daemon
+                                ? javaVM->AttachCurrentThreadAsDaemon(&env, &args)
+                                : javaVM->AttachCurrentThread(&env, &args);
+                if (attached == JNI_OK) {
                     //Create tls object which detach thread from JVM when this thread exits
                     thread_local struct DetachJniOnExit {
                         JavaVM *javaVm;
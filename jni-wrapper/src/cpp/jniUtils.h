@@ -21,18 +21,22 @@ namespace privmx {
         namespace jni {
             inline std::string getPrivmxCallbackThreadName() { return "privmx-callbacks"; }
 
+            inline std::string getPrivmxExecutorThreadName() { return "privmx-executor"; }
+
             /**
              * Attach current native thread to JVM if it is not attached.
              *
              * @param javaVM pointer to JavaVM
              * @param shortThreadName name of thread
              * @param threadGroup global ref of a ThreadGroup object or NULL
+             * @param daemon attach as daemon thread, which does not prevent JVM from exiting
              * @return JNIEnv for attached thread
              */
             JNIEnv *AttachCurrentThreadIfNeeded(
                     JavaVM *javaVM,
                     std::string shortThreadName,
-                    jobject threadGroup = nullptr
+                    jobject threadGroup = nullptr,
+                    bool daemon = false
             );
         } // jni
     } // wrapper
@@ -14,13 +14,29 @@
 namespace privmx {
     namespace wrapper {
 
+        namespace {
+            // Copies buffer to a new Java array or returns an empty one when the field is not projected
+            jbyteArray projectedBuffer2Java(
+                    JniContextUtils &ctx,
+                    const privmx::endpoint::core::Buffer &buffer,
+                    bool included
+            ) {
+                jsize size = included ? (jsize) buffer.size() : 0;
+                jbyteArray array = ctx->NewByteArray(size);
+                if (size > 0) {
+                    ctx->SetByteArrayRegion(array, 0, size, (jbyte *) buffer.data());
+                }
+                return array;
+            }
+        }
+
         //Core
         jobject
         itemPolicy2Java(
                 JniContextUtils &ctx,
                 privmx::endpoint::core::ItemPolicy itemPolicy
         ) {
-            jclass itemPolicyCls = ctx->FindClass(
+            jclass itemPolicyCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/ItemPolicy");
             jmethodID initItemPolicyMID = ctx->GetMethodID(
                     itemPolicyCls,
@@ -40,17 +56,17 @@ namespace privmx {
             jstring create = nullptr;
             jstring update = nullptr;
             jstring delete_ = nullptr;
-            if (itemPolicy.get.has_value()) get = ctx->NewStringUTF(itemPolicy.get->c_str());
+            if (itemPolicy.get.has_value()) get = ctx.string2jString(*itemPolicy.get);
             if (itemPolicy.listMy.has_value())
-                listMy = ctx->NewStringUTF(itemPolicy.listMy->c_str());
+                listMy = ctx.string2jString(*itemPolicy.listMy);
             if (itemPolicy.listAll.has_value())
-                listAll = ctx->NewStringUTF(itemPolicy.listAll->c_str());
+                listAll = ctx.string2jString(*itemPolicy.listAll);
             if (itemPolicy.create.has_value())
-                create = ctx->NewStringUTF(itemPolicy.create->c_str());
+                create = ctx.string2jString(*itemPolicy.create);
             if (itemPolicy.update.has_value())
-                update = ctx->NewStringUTF(itemPolicy.update->c_str());
+                update = ctx.string2jString(*itemPolicy.update);
             if (itemPolicy.delete_.has_value())
-                delete_ = ctx->NewStringUTF(itemPolicy.delete_->c_str());
+                delete_ = ctx.string2jString(*itemPolicy.delete_);
             return ctx->NewObject(
                     itemPolicyCls,
                     initItemPolicyMID,
@@ -67,7 +83,7 @@ namespace privmx {
                 JniContextUtils &ctx,
                 privmx::endpoint::core::ContainerPolicyWithoutItem containerPolicyWithoutItem
         ) {
-            jclass containerPolicyWithoutItemCls = ctx->FindClass(
+            jclass containerPolicyWithoutItemCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/ContainerPolicyWithoutItem");
             jmethodID initContainerPolicyWithoutItemMID = ctx->GetMethodID(
                     containerPolicyWithoutItemCls,
@@ -88,24 +104,24 @@ namespace privmx {
             jstring updaterCanBeRemovedFromManagers = nullptr;
             jstring ownerCanBeRemovedFromManagers = nullptr;
             if (containerPolicyWithoutItem.get.has_value()) {
-                get = ctx->NewStringUTF(containerPolicyWithoutItem.get->c_str());
+                get = ctx.string2jString(*containerPolicyWithoutItem.get);
             }
             if (containerPolicyWithoutItem.update.has_value()) {
-                update = ctx->NewStringUTF(containerPolicyWithoutItem.update->c_str());
+                update = ctx.string2jString(*containerPolicyWithoutItem.update);
             }
             if (containerPolicyWithoutItem.delete_.has_value()) {
-                delete_ = ctx->NewStringUTF(containerPolicyWithoutItem.delete_->c_str());
+                delete_ = ctx.string2jString(*containerPolicyWithoutItem.delete_);
             }
             if (containerPolicyWithoutItem.updatePolicy.has_value()) {
-                updatePolicy = ctx->NewStringUTF(containerPolicyWithoutItem.updatePolicy->c_str());
+                updatePolicy = ctx.string2jString(*containerPolicyWithoutItem.updatePolicy);
             }
             if (containerPolicyWithoutItem.updaterCanBeRemovedFromManagers.has_value()) {
-                updaterCanBeRemovedFromManagers = ctx->NewStringUTF(
-                        containerPolicyWithoutItem.updaterCanBeRemovedFromManagers->c_str());
+                updaterCanBeRemovedFromManagers = ctx.string2jString(
+                        *containerPolicyWithoutItem.updaterCanBeRemovedFromManagers);
             }
             if (containerPolicyWithoutItem.ownerCanBeRemovedFromManagers.has_value()) {
-                ownerCanBeRemovedFromManagers = ctx->NewStringUTF(
-                        containerPolicyWithoutItem.ownerCanBeRemovedFromManagers->c_str());
+                ownerCanBeRemovedFromManagers = ctx.string2jString(
+                        *containerPolicyWithoutItem.ownerCanBeRemovedFromManagers);
             }
 
             return ctx->NewObject(
@@ -124,7 +140,7 @@ namespace privmx {
                 JniContextUtils &ctx,
                 privmx::endpoint::core::ContainerPolicy containerPolicy
         ) {
-            jclass containerPolicyCls = ctx->FindClass(
+            jclass containerPolicyCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/ContainerPolicy");
             jmethodID initContainerPolicyMID = ctx->GetMethodID(
                     containerPolicyCls,
@@ -147,24 +163,24 @@ namespace privmx {
             jstring ownerCanBeRemovedFromManagers = nullptr;
             jobject itemPolicy = nullptr;
             if (containerPolicy.get.has_value()) {
-                get = ctx->NewStringUTF(containerPolicy.get->c_str());
+                get = ctx.string2jString(*containerPolicy.get);
             }
             if (containerPolicy.update.has_value()) {
-                update = ctx->NewStringUTF(containerPolicy.update->c_str());
+                update = ctx.string2jString(*containerPolicy.update);
             }
             if (containerPolicy.delete_.has_value()) {
-                delete_ = ctx->NewStringUTF(containerPolicy.delete_->c_str());
+                delete_ = ctx.string2jString(*containerPolicy.delete_);
             }
             if (containerPolicy.updatePolicy.has_value()) {
-                updatePolicy = ctx->NewStringUTF(containerPolicy.updatePolicy->c_str());
+                updatePolicy = ctx.string2jString(*containerPolicy.updatePolicy);
             }
             if (containerPolicy.updaterCanBeRemovedFromManagers.has_value()) {
-                updaterCanBeRemovedFromManagers = ctx->NewStringUTF(
-                        containerPolicy.updaterCanBeRemovedFromManagers->c_str());
+                updaterCanBeRemovedFromManagers = ctx.string2jString(
+                        *containerPolicy.updaterCanBeRemovedFromManagers);
             }
             if (containerPolicy.ownerCanBeRemovedFromManagers.has_value()) {
-                ownerCanBeRemovedFromManagers = ctx->NewStringUTF(
-                        containerPolicy.ownerCanBeRemovedFromManagers->c_str());
+                ownerCanBeRemovedFromManagers = ctx.string2jString(
+                        *containerPolicy.ownerCanBeRemovedFromManagers);
             }
             if (containerPolicy.item.has_value()) {
                 itemPolicy = itemPolicy2Java(ctx, containerPolicy.item.value());
@@ -183,12 +199,32 @@ namespace privmx {
             );
         }
 
+        //Native memory
+        jobject nativeBuffer2Java(JniContextUtils &ctx, privmx::endpoint::core::Buffer buffer_c) {
+            jclass nativeBufferCls = ctx.findClass(
+                    "com/simplito/kotlin/privmx_endpoint/modules/core/NativeBuffer");
+            jmethodID initNativeBufferMID = ctx->GetMethodID(
+                    nativeBufferCls, "<init>", "(J)V");
+
+            // Shared with the direct views, which hold their own references
+            auto *buffer = new std::shared_ptr<privmx::endpoint::core::Buffer>(
+                    std::make_shared<privmx::endpoint::core::Buffer>(std::move(buffer_c)));
+            jobject result = ctx->NewObject(
+                    nativeBufferCls,
+                    initNativeBufferMID,
+                    (jlong) buffer);
+            if (result == nullptr) {
+                delete buffer;
+            }
+            return result;
+        }
+
         //Context
         jobject context2Java(
                 JniContextUtils &ctx,
                 privmx::endpoint::core::Context context_c
         ) {
-            jclass contextCls = ctx->FindClass(
+            jclass contextCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/Context");
             jmethodID initThreadDataMID = ctx->GetMethodID(
                     contextCls,
@@ -198,8 +234,8 @@ namespace privmx {
             return ctx->NewObject(
                     contextCls,
                     initThreadDataMID,
-                    ctx->NewStringUTF(context_c.userId.c_str()),
-                    ctx->NewStringUTF(context_c.contextId.c_str())
+                    ctx.internString(context_c.userId),
+                    ctx.string2jString(context_c.contextId)
             );
         }
 
@@ -208,7 +244,7 @@ namespace privmx {
                 JniContextUtils &ctx,
                 privmx::endpoint::core::UserWithPubKey userWithPubKey
         ) {
-            jclass userCls = ctx->FindClass(
+            jclass userCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/UserWithPubKey");
             jmethodID initUserMID = ctx->GetMethodID(
                     userCls,
@@ -218,8 +254,8 @@ namespace privmx {
             return ctx->NewObject(
                     userCls,
                     initUserMID,
-                    ctx->NewStringUTF(userWithPubKey.userId.c_str()),
-                    ctx->NewStringUTF(userWithPubKey.pubKey.c_str())
+                    ctx.string2jString(userWithPubKey.userId),
+                    ctx.string2jString(userWithPubKey.pubKey)
             );
         }
 
@@ -228,7 +264,7 @@ namespace privmx {
                 JniContextUtils &ctx,
                 privmx::endpoint::core::UserInfo userInfo
         ) {
-            jclass userInfoCls = ctx->FindClass(
+            jclass userInfoCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/UserInfo");
             jmethodID initUserInfoMID = ctx->GetMethodID(
                     userInfoCls,
@@ -264,18 +300,18 @@ namespace privmx {
 
             jstring pubKey_c = nullptr;
             if (bridgeIdentity_c.pubKey.has_value()) {
-                pubKey_c = ctx->NewStringUTF(bridgeIdentity_c.pubKey.value().c_str());
+                pubKey_c = ctx.string2jString(bridgeIdentity_c.pubKey.value());
             }
 
             jstring instanceId_c = nullptr;
             if (bridgeIdentity_c.instanceId.has_value()) {
-                instanceId_c = ctx->NewStringUTF(bridgeIdentity_c.instanceId.value().c_str());
+                instanceId_c = ctx.string2jString(bridgeIdentity_c.instanceId.value());
             }
 
             return ctx->NewObject(
                     bridgeIdentityCls,
                     initBridgeIdentityMID,
-                    ctx->NewStringUTF(bridgeIdentity_c.url.c_str()),
+                    ctx.string2jString(bridgeIdentity_c.url),
                     pubKey_c,
                     instanceId_c
             );
@@ -308,9 +344,9 @@ namespace privmx {
             return ctx->NewObject(
                     verificationRequestCls,
                     initVerificationRequestMID,
-                    ctx->NewStringUTF(verificationRequest_c.contextId.c_str()),
-                    ctx->NewStringUTF(verificationRequest_c.senderId.c_str()),
-                    ctx->NewStringUTF(verificationRequest_c.senderPubKey.c_str()),
+                    ctx.string2jString(verificationRequest_c.contextId),
+                    ctx.string2jString(verificationRequest_c.senderId),
+                    ctx.string2jString(verificationRequest_c.senderPubKey),
                     ctx.long2jLong(verificationRequest_c.date),
                     bridgeIdentity
             );
@@ -318,7 +354,7 @@ namespace privmx {
 
         //Crypto
         jobject extKey2Java(JniContextUtils &ctx, privmx::endpoint::crypto::ExtKey extKey_c) {
-            jclass ExtKeyCls = ctx->FindClass(
+            jclass ExtKeyCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/modules/crypto/ExtKey");
             jmethodID initExtKeyMID = ctx->GetMethodID(
                     ExtKeyCls, "<init>", "(Ljava/lang/Long;)V");
@@ -331,7 +367,7 @@ namespace privmx {
         }
 
         jobject BIP392Java(JniContextUtils &ctx, privmx::endpoint::crypto::BIP39_t BIP39_c) {
-            jclass BIP39Cls = ctx->FindClass(
+            jclass BIP39Cls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/BIP39");
             jmethodID initBIP39MID = ctx->GetMethodID(
                     BIP39Cls,
@@ -349,7 +385,7 @@ namespace privmx {
             return ctx->NewObject(
                     BIP39Cls,
                     initBIP39MID,
-                    ctx->NewStringUTF(BIP39_c.mnemonic.c_str()),
+                    ctx.secret2jString(BIP39_c.mnemonic),
                     extKey2Java(ctx, BIP39_c.ext_key),
                     entropy
             );
@@ -357,7 +393,7 @@ namespace privmx {
 
         //Threads
         jobject thread2Java(JniContextUtils &ctx, privmx::endpoint::thread::Thread thread_c) {
-            jclass threadCls = ctx->FindClass(
+            jclass threadCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/Thread");
             jmethodID initThreadMID = ctx->GetMethodID(
                     threadCls,
@@ -381,38 +417,18 @@ namespace privmx {
                     "Ljava/lang/Long;"
                     ")V"
             );
-            jclass arrayCls = ctx->FindClass("java/util/ArrayList");
-            jmethodID initArrayMID = ctx->GetMethodID(
-                    arrayCls,
-                    "<init>",
-                    "()V");
-            jmethodID addToArrayMID = ctx->GetMethodID(
-                    arrayCls,
-                    "add",
-                    "(Ljava/lang/Object;)Z"
-            );
-            jstring threadId = ctx->NewStringUTF(thread_c.threadId.c_str());
-            jstring contextId = ctx->NewStringUTF(thread_c.contextId.c_str());
-            jstring creator = ctx->NewStringUTF(thread_c.creator.c_str());
-            jstring lastModifier = ctx->NewStringUTF(thread_c.lastModifier.c_str());
-            jobject users = ctx->NewObject(arrayCls, initArrayMID);
-            jobject managers = ctx->NewObject(arrayCls, initArrayMID);
+            jstring threadId = ctx.string2jString(thread_c.threadId);
+            jstring contextId = ctx.internString(thread_c.contextId);
+            jstring creator = ctx.internString(thread_c.creator);
+            jstring lastModifier = ctx.internString(thread_c.lastModifier);
+            jobject users = ctx.strings2jList(thread_c.users);
+            jobject managers = ctx.strings2jList(thread_c.managers);
             jbyteArray publicMeta = ctx->NewByteArray(thread_c.publicMeta.size());
             jbyteArray privateMeta = ctx->NewByteArray(thread_c.privateMeta.size());
             ctx->SetByteArrayRegion(publicMeta, 0, thread_c.publicMeta.size(),
                                     (jbyte *) thread_c.publicMeta.data());
             ctx->SetByteArrayRegion(privateMeta, 0, thread_c.privateMeta.size(),
                                     (jbyte *) thread_c.privateMeta.data());
-            for (auto &user: thread_c.users) {
-                ctx->CallBooleanMethod(users,
-                                       addToArrayMID,
-                                       ctx->NewStringUTF(user.c_str()));
-            }
-            for (auto &manager: thread_c.managers) {
-                ctx->CallBooleanMethod(managers,
-                                       addToArrayMID,
-                                       ctx->NewStringUTF(manager.c_str()));
-            }
             return ctx->NewObject(
                     threadCls,
                     initThreadMID,
@@ -438,7 +454,7 @@ namespace privmx {
         //Messages
         jobject serverMessageInfo2Java(JniContextUtils &ctx,
                                        privmx::endpoint::thread::ServerMessageInfo serverMessageInfo_c) {
-            jclass messageCls = ctx->FindClass(
+            jclass messageCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/ServerMessageInfo");
             jmethodID initMessageMID = ctx->GetMethodID(
                     messageCls,
@@ -448,15 +464,17 @@ namespace privmx {
             return ctx->NewObject(
                     messageCls,
                     initMessageMID,
-                    ctx->NewStringUTF(serverMessageInfo_c.threadId.c_str()),
-                    ctx->NewStringUTF(serverMessageInfo_c.messageId.c_str()),
+                    ctx.internString(serverMessageInfo_c.threadId),
+                    ctx.string2jString(serverMessageInfo_c.messageId),
                     ctx.long2jLong(serverMessageInfo_c.createDate),
-                    ctx->NewStringUTF(serverMessageInfo_c.author.c_str())
+                    ctx.internString(serverMessageInfo_c.author)
             );
         }
 
-        jobject message2Java(JniContextUtils &ctx, privmx::endpoint::thread::Message message_c) {
-            jclass messageCls = ctx->FindClass(
+        jobject message2Java(JniContextUtils &ctx,
+                             const privmx::endpoint::thread::Message &message_c,
+                             jint fields) {
+            jclass messageCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/Message");
             jmethodID initMessageMID = ctx->GetMethodID(
                     messageCls,
@@ -471,17 +489,12 @@ namespace privmx {
                     ")V"
             );
 
-            jbyteArray publicMeta = ctx->NewByteArray(message_c.publicMeta.size());
-            jbyteArray privateMeta = ctx->NewByteArray(message_c.privateMeta.size());
-            jbyteArray data = ctx->NewByteArray(message_c.data.size());
-            ctx->SetByteArrayRegion(publicMeta, 0, message_c.publicMeta.size(),
-                                    (jbyte *) message_c.publicMeta.data());
-
-            ctx->SetByteArrayRegion(privateMeta, 0, message_c.privateMeta.size(),
-                                    (jbyte *) message_c.privateMeta.data());
-
-            ctx->SetByteArrayRegion(data, 0, message_c.data.size(),
-                                    (jbyte *) message_c.data.data());
+            jbyteArray publicMeta = projectedBuffer2Java(ctx, message_c.publicMeta,
+                                                         fields & projection::PUBLIC_META);
+            jbyteArray privateMeta = projectedBuffer2Java(ctx, message_c.privateMeta,
+                                                          fields & projection::PRIVATE_META);
+            jbyteArray data = projectedBuffer2Java(ctx, message_c.data,
+                                                   fields & projection::DATA);
 
             return ctx->NewObject(
                     messageCls,
@@ -490,26 +503,44 @@ namespace privmx {
                     publicMeta,
                     privateMeta,
                     data,
-                    ctx->NewStringUTF(message_c.authorPubKey.c_str()),
+                    ctx.internString(message_c.authorPubKey),
                     ctx.long2jLong(message_c.statusCode),
                     ctx.long2jLong(message_c.schemaVersion)
             );
         }
 
-        //Store
-        jobject store2Java(JniContextUtils &ctx, privmx::endpoint::store::Store store_c) {
-            jclass arrayCls = ctx->FindClass("java/util/ArrayList");
-            jmethodID initArrayMID = ctx->GetMethodID(
-                    arrayCls,
+        jobject lazyMessage2Java(JniContextUtils &ctx, privmx::endpoint::thread::Message message_c) {
+            jclass lazyMessageCls = ctx.findClass(
+                    "com/simplito/kotlin/privmx_endpoint/model/LazyMessage");
+            jmethodID initLazyMessageMID = ctx->GetMethodID(
+                    lazyMessageCls,
                     "<init>",
-                    "()V");
-            jmethodID addToArrayMID = ctx->GetMethodID(
-                    arrayCls,
-                    "add",
-                    "(Ljava/lang/Object;)Z"
+                    "(Lcom/simplito/kotlin/privmx_endpoint/model/ServerMessageInfo;"
+                    "Lcom/simplito/kotlin/privmx_endpoint/modules/core/NativeBuffer;" // publicMeta
+                    "Lcom/simplito/kotlin/privmx_endpoint/modules/core/NativeBuffer;" // privateMeta
+                    "Lcom/simplito/kotlin/privmx_endpoint/modules/core/NativeBuffer;" // data
+                    "Ljava/lang/String;"
+                    "Ljava/lang/Long;"
+                    "Ljava/lang/Long;"
+                    ")V"
             );
 
-            jclass storeCls = ctx->FindClass(
+            return ctx->NewObject(
+                    lazyMessageCls,
+                    initLazyMessageMID,
+                    serverMessageInfo2Java(ctx, message_c.info),
+                    nativeBuffer2Java(ctx, std::move(message_c.publicMeta)),
+                    nativeBuffer2Java(ctx, std::move(message_c.privateMeta)),
+                    nativeBuffer2Java(ctx, std::move(message_c.data)),
+                    ctx.internString(message_c.authorPubKey),
+                    ctx.long2jLong(message_c.statusCode),
+                    ctx.long2jLong(message_c.schemaVersion)
+            );
+        }
+
+        //Store
+        jobject store2Java(JniContextUtils &ctx, privmx::endpoint::store::Store store_c) {
+            jclass storeCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/Store");
             jmethodID initStoreMID = ctx->GetMethodID(
                     storeCls,
@@ -534,35 +565,25 @@ namespace privmx {
                     ")V"
             );
 
-            jobject users = ctx->NewObject(arrayCls, initArrayMID);
-            jobject managers = ctx->NewObject(arrayCls, initArrayMID);
+            jobject users = ctx.strings2jList(store_c.users);
+            jobject managers = ctx.strings2jList(store_c.managers);
             jbyteArray publicMeta = ctx->NewByteArray(store_c.publicMeta.size());
             jbyteArray privateMeta = ctx->NewByteArray(store_c.privateMeta.size());
             ctx->SetByteArrayRegion(publicMeta, 0, store_c.publicMeta.size(),
                                     (jbyte *) store_c.publicMeta.data());
             ctx->SetByteArrayRegion(privateMeta, 0, store_c.privateMeta.size(),
                                     (jbyte *) store_c.privateMeta.data());
-            for (auto &user: store_c.users) {
-                ctx->CallBooleanMethod(users,
-                                       addToArrayMID,
-                                       ctx->NewStringUTF(user.c_str()));
-            }
-            for (auto &manager: store_c.managers) {
-                ctx->CallBooleanMethod(managers,
-                                       addToArrayMID,
-                                       ctx->NewStringUTF(manager.c_str()));
-            }
 
             return ctx->NewObject(
                     storeCls,
                     initStoreMID,
-                    ctx->NewStringUTF(store_c.storeId.c_str()),
-                    ctx->NewStringUTF(store_c.contextId.c_str()),
+                    ctx.string2jString(store_c.storeId),
+                    ctx.internString(store_c.contextId),
                     ctx.long2jLong(store_c.createDate),
-                    ctx->NewStringUTF(store_c.creator.c_str()),
+                    ctx.internString(store_c.creator),
                     ctx.long2jLong(store_c.lastModificationDate),
                     ctx.long2jLong(store_c.lastFileDate),
-                    ctx->NewStringUTF(store_c.lastModifier.c_str()),
+                    ctx.internString(store_c.lastModifier),
                     users,
                     managers,
                     ctx.long2jLong(store_c.version),
@@ -577,7 +598,7 @@ namespace privmx {
 
         //Inbox
         jobject inbox2Java(JniContextUtils &ctx, privmx::endpoint::inbox::Inbox inbox_c) {
-            jclass inboxCls = ctx->FindClass(
+            jclass inboxCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/Inbox");
             jmethodID initInboxMID = ctx->GetMethodID(
                     inboxCls,
@@ -600,34 +621,14 @@ namespace privmx {
                     "Ljava/lang/Long;" //schemaVersion
                     ")V"
             );
-            jclass arrayCls = ctx->FindClass("java/util/ArrayList");
-            jmethodID initArrayMID = ctx->GetMethodID(
-                    arrayCls,
-                    "<init>",
-                    "()V");
-            jmethodID addToArrayMID = ctx->GetMethodID(
-                    arrayCls,
-                    "add",
-                    "(Ljava/lang/Object;)Z"
-            );
-            jobject users = ctx->NewObject(arrayCls, initArrayMID);
-            jobject managers = ctx->NewObject(arrayCls, initArrayMID);
+            jobject users = ctx.strings2jList(inbox_c.users);
+            jobject managers = ctx.strings2jList(inbox_c.managers);
             jbyteArray publicMeta = ctx->NewByteArray(inbox_c.publicMeta.size());
             jbyteArray privateMeta = ctx->NewByteArray(inbox_c.privateMeta.size());
             ctx->SetByteArrayRegion(publicMeta, 0, inbox_c.publicMeta.size(),
                                     (jbyte *) inbox_c.publicMeta.data());
             ctx->SetByteArrayRegion(privateMeta, 0, inbox_c.privateMeta.size(),
                                     (jbyte *) inbox_c.privateMeta.data());
-            for (auto &user: inbox_c.users) {
-                ctx->CallBooleanMethod(users,
-                                       addToArrayMID,
-                                       ctx->NewStringUTF(user.c_str()));
-            }
-            for (auto &manager: inbox_c.managers) {
-                ctx->CallBooleanMethod(managers,
-                                       addToArrayMID,
-                                       ctx->NewStringUTF(manager.c_str()));
-            }
 
             jobject filesConfig = nullptr;
             if (inbox_c.filesConfig.has_value()) {
@@ -637,12 +638,12 @@ namespace privmx {
             return ctx->NewObject(
                     inboxCls,
                     initInboxMID,
-                    ctx->NewStringUTF(inbox_c.inboxId.c_str()),
-                    ctx->NewStringUTF(inbox_c.contextId.c_str()),
+                    ctx.string2jString(inbox_c.inboxId),
+                    ctx.internString(inbox_c.contextId),
                     ctx.long2jLong(inbox_c.createDate),
-                    ctx->NewStringUTF(inbox_c.creator.c_str()),
+                    ctx.internString(inbox_c.creator),
                     ctx.long2jLong(inbox_c.lastModificationDate),
-                    ctx->NewStringUTF(inbox_c.lastModifier.c_str()),
+                    ctx.internString(inbox_c.lastModifier),
                     users,
                     managers,
                     ctx.long2jLong(inbox_c.version),
@@ -656,8 +657,10 @@ namespace privmx {
         }
 
         jobject
-        inboxEntry2Java(JniContextUtils &ctx, privmx::endpoint::inbox::InboxEntry inboxEntry_c) {
-            jclass inboxEntryCls = ctx->FindClass(
+        inboxEntry2Java(JniContextUtils &ctx,
+                        const privmx::endpoint::inbox::InboxEntry &inboxEntry_c,
+                        jint fields) {
+            jclass inboxEntryCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/InboxEntry");
             jmethodID initEntryViewMID = ctx->GetMethodID(
                     inboxEntryCls,
@@ -673,33 +676,59 @@ namespace privmx {
                     "Ljava/lang/Long;" // schemaVersion
                     ")V"
             );
-            jclass arrayCls = ctx->FindClass("java/util/ArrayList");
-            jmethodID initArrayMID = ctx->GetMethodID(
-                    arrayCls,
-                    "<init>",
-                    "()V");
-            jmethodID addToArrayMID = ctx->GetMethodID(
-                    arrayCls,
-                    "add",
-                    "(Ljava/lang/Object;)Z"
-            );
-            jbyteArray data = ctx->NewByteArray(inboxEntry_c.data.size());
-            ctx->SetByteArrayRegion(data, 0, inboxEntry_c.data.size(),
-                                    (jbyte *) inboxEntry_c.data.data());
-            jobject files = ctx->NewObject(arrayCls, initArrayMID);
-            for (auto &file: inboxEntry_c.files) {
-                ctx->CallBooleanMethod(files,
-                                       addToArrayMID,
-                                       file2Java(ctx, file));
-            }
+            jbyteArray data = projectedBuffer2Java(ctx, inboxEntry_c.data,
+                                                   fields & projection::DATA);
+            std::vector<privmx::endpoint::store::File> noFiles;
+            jobject files = ctx.vector2jList(
+                    (fields & projection::FILES) ? inboxEntry_c.files : noFiles,
+                    [&ctx, fields](const privmx::endpoint::store::File &file) {
+                        return file2Java(ctx, file, fields);
+                    });
             return ctx->NewObject(
                     inboxEntryCls,
                     initEntryViewMID,
-                    ctx->NewStringUTF(inboxEntry_c.entryId.c_str()),
-                    ctx->NewStringUTF(inboxEntry_c.inboxId.c_str()),
+                    ctx.string2jString(inboxEntry_c.entryId),
+                    ctx.internString(inboxEntry_c.inboxId),
                     data,
                     files,
-                    ctx->NewStringUTF(inboxEntry_c.authorPubKey.c_str()),
+                    ctx.internString(inboxEntry_c.authorPubKey),
+                    ctx.long2jLong(inboxEntry_c.createDate),
+                    ctx.long2jLong(inboxEntry_c.statusCode),
+                    ctx.long2jLong(inboxEntry_c.schemaVersion)
+            );
+        }
+
+        jobject lazyInboxEntry2Java(JniContextUtils &ctx,
+                                    privmx::endpoint::inbox::InboxEntry inboxEntry_c) {
+            jclass lazyInboxEntryCls = ctx.findClass(
+                    "com/simplito/kotlin/privmx_endpoint/model/LazyInboxEntry");
+            jmethodID initLazyInboxEntryMID = ctx->GetMethodID(
+                    lazyInboxEntryCls,
+                    "<init>",
+                    "("
+                    "Ljava/lang/String;" //entryId
+                    "Ljava/lang/String;" //inboxId
+                    "Lcom/simplito/kotlin/privmx_endpoint/modules/core/NativeBuffer;" //data
+                    "Ljava/util/List;" //files
+                    "Ljava/lang/String;" //authorPubKey
+                    "Ljava/lang/Long;" // createDate
+                    "Ljava/lang/Long;" // statusCode
+                    "Ljava/lang/Long;" // schemaVersion
+                    ")V"
+            );
+            jobject files = ctx.vector2jList(
+                    inboxEntry_c.files,
+                    [&ctx](privmx::endpoint::store::File &file) {
+                        return lazyFile2Java(ctx, std::move(file));
+                    });
+            return ctx->NewObject(
+                    lazyInboxEntryCls,
+                    initLazyInboxEntryMID,
+                    ctx.string2jString(inboxEntry_c.entryId),
+                    ctx.internString(inboxEntry_c.inboxId),
+                    nativeBuffer2Java(ctx, std::move(inboxEntry_c.data)),
+                    files,
+                    ctx.internString(inboxEntry_c.authorPubKey),
                     ctx.long2jLong(inboxEntry_c.createDate),
                     ctx.long2jLong(inboxEntry_c.statusCode),
                     ctx.long2jLong(inboxEntry_c.schemaVersion)
@@ -708,7 +737,7 @@ namespace privmx {
 
         jobject inboxPublicView2Java(JniContextUtils &ctx,
                                      privmx::endpoint::inbox::InboxPublicView inboxPublicView_c) {
-            jclass inboxPublicViewCls = ctx->FindClass(
+            jclass inboxPublicViewCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/InboxPublicView");
             jmethodID initInboxPublicViewMID = ctx->GetMethodID(
                     inboxPublicViewCls,
@@ -725,7 +754,7 @@ namespace privmx {
             return ctx->NewObject(
                     inboxPublicViewCls,
                     initInboxPublicViewMID,
-                    ctx->NewStringUTF(inboxPublicView_c.inboxId.c_str()),
+                    ctx.string2jString(inboxPublicView_c.inboxId),
                     ctx.long2jLong(inboxPublicView_c.version),
                     publicMeta
             );
@@ -733,7 +762,7 @@ namespace privmx {
 
         jobject
         filesConfig2Java(JniContextUtils &ctx, privmx::endpoint::inbox::FilesConfig filesConfig_c) {
-            jclass filesConfigCls = ctx->FindClass(
+            jclass filesConfigCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/FilesConfig");
             jmethodID initFilesConfigMID = ctx->GetMethodID(
                     filesConfigCls,
@@ -758,7 +787,7 @@ namespace privmx {
         //Files
         jobject serverFileInfo2Java(JniContextUtils &ctx,
                                     privmx::endpoint::store::ServerFileInfo serverFileInfo_c) {
-            jclass serverFileInfoCls = ctx->FindClass(
+            jclass serverFileInfoCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/ServerFileInfo");
             jmethodID initServerFileInfoMID = ctx->GetMethodID(
                     serverFileInfoCls,
@@ -768,15 +797,17 @@ namespace privmx {
             return ctx->NewObject(
                     serverFileInfoCls,
                     initServerFileInfoMID,
-                    ctx->NewStringUTF(serverFileInfo_c.storeId.c_str()),
-                    ctx->NewStringUTF(serverFileInfo_c.fileId.c_str()),
+                    ctx.internString(serverFileInfo_c.storeId),
+                    ctx.string2jString(serverFileInfo_c.fileId),
                     ctx.long2jLong(serverFileInfo_c.createDate),
-                    ctx->NewStringUTF(serverFileInfo_c.author.c_str())
+                    ctx.internString(serverFileInfo_c.author)
             );
         }
 
-        jobject file2Java(JniContextUtils &ctx, privmx::endpoint::store::File file_c) {
-            jclass fileCls = ctx->FindClass(
+        jobject file2Java(JniContextUtils &ctx,
+                          const privmx::endpoint::store::File &file_c,
+                          jint fields) {
+            jclass fileCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/File");
             jmethodID initFileMID = ctx->GetMethodID(
                     fileCls,
@@ -792,13 +823,10 @@ namespace privmx {
                     ")V"
             );
 
-            jbyteArray publicMeta = ctx->NewByteArray(file_c.publicMeta.size());
-            jbyteArray privateMeta = ctx->NewByteArray(file_c.privateMeta.size());
-            ctx->SetByteArrayRegion(publicMeta, 0, file_c.publicMeta.size(),
-                                    (jbyte *) file_c.publicMeta.data());
-
-            ctx->SetByteArrayRegion(privateMeta, 0, file_c.privateMeta.size(),
-                                    (jbyte *) file_c.privateMeta.data());
+            jbyteArray publicMeta = projectedBuffer2Java(ctx, file_c.publicMeta,
+                                                         fields & projection::PUBLIC_META);
+            jbyteArray privateMeta = projectedBuffer2Java(ctx, file_c.privateMeta,
+                                                          fields & projection::PRIVATE_META);
 
             return ctx->NewObject(
                     fileCls,
@@ -807,7 +835,37 @@ namespace privmx {
                     publicMeta,
                     privateMeta,
                     ctx.long2jLong(file_c.size),
-                    ctx->NewStringUTF(file_c.authorPubKey.c_str()),
+                    ctx.internString(file_c.authorPubKey),
+                    ctx.long2jLong(file_c.statusCode),
+                    ctx.long2jLong(file_c.schemaVersion)
+            );
+        }
+
+        jobject lazyFile2Java(JniContextUtils &ctx, privmx::endpoint::store::File file_c) {
+            jclass lazyFileCls = ctx.findClass(
+                    "com/simplito/kotlin/privmx_endpoint/model/LazyFile");
+            jmethodID initLazyFileMID = ctx->GetMethodID(
+                    lazyFileCls,
+                    "<init>",
+                    "("
+                    "Lcom/simplito/kotlin/privmx_endpoint/model/ServerFileInfo;"
+                    "Lcom/simplito/kotlin/privmx_endpoint/modules/core/NativeBuffer;" // publicMeta
+                    "Lcom/simplito/kotlin/privmx_endpoint/modules/core/NativeBuffer;" // privateMeta
+                    "Ljava/lang/Long;"
+                    "Ljava/lang/String;"
+                    "Ljava/lang/Long;"
+                    "Ljava/lang/Long;"
+                    ")V"
+            );
+
+            return ctx->NewObject(
+                    lazyFileCls,
+                    initLazyFileMID,
+                    serverFileInfo2Java(ctx, file_c.info),
+                    nativeBuffer2Java(ctx, std::move(file_c.publicMeta)),
+                    nativeBuffer2Java(ctx, std::move(file_c.privateMeta)),
+                    ctx.long2jLong(file_c.size),
+                    ctx.internString(file_c.authorPubKey),
                     ctx.long2jLong(file_c.statusCode),
                     ctx.long2jLong(file_c.schemaVersion)
             );
@@ -816,7 +874,7 @@ namespace privmx {
         //Event
         jobject storeFileDeletedEventData2Java(JniContextUtils &ctx,
                                                privmx::endpoint::store::StoreFileDeletedEventData storeFileDeletedEventData_c) {
-            jclass storeFileDeletedEventDataCls = ctx->FindClass(
+            jclass storeFileDeletedEventDataCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/events/StoreFileDeletedEventData");
             jmethodID initStoreFileDeletedEventDataMID = ctx->GetMethodID(
                     storeFileDeletedEventDataCls,
@@ -826,15 +884,15 @@ namespace privmx {
             return ctx->NewObject(
                     storeFileDeletedEventDataCls,
                     initStoreFileDeletedEventDataMID,
-                    ctx->NewStringUTF(storeFileDeletedEventData_c.fileId.c_str()),
-                    ctx->NewStringUTF(storeFileDeletedEventData_c.contextId.c_str()),
-                    ctx->NewStringUTF(storeFileDeletedEventData_c.storeId.c_str())
+                    ctx.string2jString(storeFileDeletedEventData_c.fileId),
+                    ctx.string2jString(storeFileDeletedEventData_c.contextId),
+                    ctx.string2jString(storeFileDeletedEventData_c.storeId)
             );
         }
 
         jobject storeStatsChangedEventData2Java(JniContextUtils &ctx,
                                                 privmx::endpoint::store::StoreStatsChangedEventData storeStatsChangedEventData_c) {
-            jclass storeStatsChangedEventDataCls = ctx->FindClass(
+            jclass storeStatsChangedEventDataCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/events/StoreStatsChangedEventData");
             jmethodID initStoreStatsChangedEventDataMID = ctx->GetMethodID(
                     storeStatsChangedEventDataCls,
@@ -844,8 +902,8 @@ namespace privmx {
             return ctx->NewObject(
                     storeStatsChangedEventDataCls,
                     initStoreStatsChangedEventDataMID,
-                    ctx->NewStringUTF(storeStatsChangedEventData_c.storeId.c_str()),
-                    ctx->NewStringUTF(storeStatsChangedEventData_c.contextId.c_str()),
+                    ctx.string2jString(storeStatsChangedEventData_c.storeId),
+                    ctx.string2jString(storeStatsChangedEventData_c.contextId),
                     ctx.long2jLong(storeStatsChangedEventData_c.lastFileDate),
                     ctx.long2jLong(storeStatsChangedEventData_c.filesCount)
             );
@@ -853,7 +911,7 @@ namespace privmx {
 
         jobject threadDeletedEventData2Java(JniContextUtils &ctx,
                                             privmx::endpoint::thread::ThreadDeletedEventData threadDeletedEventData_c) {
-            jclass threadDeletedEventDataCls = ctx->FindClass(
+            jclass threadDeletedEventDataCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/events/ThreadDeletedEventData");
             jmethodID initThreadDeletedEventDataMID = ctx->GetMethodID(
                     threadDeletedEventDataCls,
@@ -863,13 +921,13 @@ namespace privmx {
             return ctx->NewObject(
                     threadDeletedEventDataCls,
                     initThreadDeletedEventDataMID,
-                    ctx->NewStringUTF(threadDeletedEventData_c.threadId.c_str())
+                    ctx.string2jString(threadDeletedEventData_c.threadId)
             );
         }
 
         jobject threadDeletedMessageEventData2Java(JniContextUtils &ctx,
                                                    privmx::endpoint::thread::ThreadDeletedMessageEventData threadDeletedMessageEventData) {
-            jclass threadDeletedMessageEventDataCls = ctx->FindClass(
+            jclass threadDeletedMessageEventDataCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/events/ThreadDeletedMessageEventData");
             jmethodID initThreadDeletedMessageEventDataMID = ctx->GetMethodID(
                     threadDeletedMessageEventDataCls,
@@ -879,14 +937,14 @@ namespace privmx {
             return ctx->NewObject(
                     threadDeletedMessageEventDataCls,
                     initThreadDeletedMessageEventDataMID,
-                    ctx->NewStringUTF(threadDeletedMessageEventData.threadId.c_str()),
-                    ctx->NewStringUTF(threadDeletedMessageEventData.messageId.c_str())
+                    ctx.string2jString(threadDeletedMessageEventData.threadId),
+                    ctx.string2jString(threadDeletedMessageEventData.messageId)
             );
         }
 
         jobject storeDeletedEventData2Java(JniContextUtils &ctx,
                                            privmx::endpoint::store::StoreDeletedEventData storeDeletedEventData_c) {
-            jclass storeDeletedEventDataCls = ctx->FindClass(
+            jclass storeDeletedEventDataCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/events/StoreDeletedEventData");
             jmethodID initStoreDeletedEventDataMID = ctx->GetMethodID(
                     storeDeletedEventDataCls,
@@ -896,7 +954,7 @@ namespace privmx {
             return ctx->NewObject(
                     storeDeletedEventDataCls,
                     initStoreDeletedEventDataMID,
-                    ctx->NewStringUTF(storeDeletedEventData_c.storeId.c_str())
+                    ctx.string2jString(storeDeletedEventData_c.storeId)
             );
         }
 
@@ -904,7 +962,7 @@ namespace privmx {
                 JniContextUtils &ctx,
                 privmx::endpoint::thread::ThreadStatsEventData threadStatsEventData_c
         ) {
-            jclass threadStatsEventDataCls = ctx->FindClass(
+            jclass threadStatsEventDataCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/events/ThreadStatsEventData");
             jmethodID initThreadStatsEventDataMID = ctx->GetMethodID(
                     threadStatsEventDataCls,
@@ -914,7 +972,7 @@ namespace privmx {
             return ctx->NewObject(
                     threadStatsEventDataCls,
                     initThreadStatsEventDataMID,
-                    ctx->NewStringUTF(threadStatsEventData_c.threadId.c_str()),
+                    ctx.string2jString(threadStatsEventData_c.threadId),
                     ctx.long2jLong(threadStatsEventData_c.lastMsgDate),
                     ctx.long2jLong(threadStatsEventData_c.messagesCount)
             );
@@ -924,7 +982,7 @@ namespace privmx {
                 JniContextUtils &ctx,
                 privmx::endpoint::inbox::InboxDeletedEventData inboxDeletedEventData_c
         ) {
-            jclass inboxDeletedEventDataCls = ctx->FindClass(
+            jclass inboxDeletedEventDataCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/events/InboxDeletedEventData");
             jmethodID initInboxDeletedEventDataMID = ctx->GetMethodID(
                     inboxDeletedEventDataCls,
@@ -934,7 +992,7 @@ namespace privmx {
             return ctx->NewObject(
                     inboxDeletedEventDataCls,
                     initInboxDeletedEventDataMID,
-                    ctx->NewStringUTF(inboxDeletedEventData_c.inboxId.c_str())
+                    ctx.string2jString(inboxDeletedEventData_c.inboxId)
             );
         }
 
@@ -942,7 +1000,7 @@ namespace privmx {
                 JniContextUtils &ctx,
                 privmx::endpoint::inbox::InboxEntryDeletedEventData inboxEntryDeletedEventData_c
         ) {
-            jclass inboxEntryDeletedEventDataCls = ctx->FindClass(
+            jclass inboxEntryDeletedEventDataCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/events/InboxEntryDeletedEventData");
             jmethodID initInboxEntryDeletedEventDataMID = ctx->GetMethodID(
                     inboxEntryDeletedEventDataCls,
@@ -952,8 +1010,8 @@ namespace privmx {
             return ctx->NewObject(
                     inboxEntryDeletedEventDataCls,
                     initInboxEntryDeletedEventDataMID,
-                    ctx->NewStringUTF(inboxEntryDeletedEventData_c.inboxId.c_str()),
-                    ctx->NewStringUTF(inboxEntryDeletedEventData_c.entryId.c_str())
+                    ctx.string2jString(inboxEntryDeletedEventData_c.inboxId),
+                    ctx.string2jString(inboxEntryDeletedEventData_c.entryId)
             );
         }
 
@@ -961,7 +1019,7 @@ namespace privmx {
                 JniContextUtils &ctx,
                 privmx::endpoint::event::ContextCustomEventData contextCustomEvent_c
         ) {
-            jclass contextCustomEventDataCls = ctx->FindClass(
+            jclass contextCustomEventDataCls = ctx.findClass(
                     "com/simplito/kotlin/privmx_endpoint/model/events/ContextCustomEventData");
             jmethodID initContextCustomEventDataMID = ctx->GetMethodID(
                     contextCustomEventDataCls,
@@ -974,8 +1032,8 @@ namespace privmx {
             return ctx->NewObject(
                     contextCustomEventDataCls,
                     initContextCustomEventDataMID,
-                    ctx->NewStringUTF(contextCustomEvent_c.contextId.c_str()),
-                    ctx->NewStringUTF(contextCustomEvent_c.userId.c_str()),
+                    ctx.string2jString(contextCustomEvent_c.contextId),
+                    ctx.string2jString(contextCustomEvent_c.userId),
                     data
             );
         }
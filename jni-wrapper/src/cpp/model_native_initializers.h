@@ -35,7 +35,40 @@
 
 namespace privmx {
     namespace wrapper {
+        // Bits of FieldProjection mask selecting which payload fields are copied to Java
+        namespace projection {
+            constexpr jint DATA = 1 << 0;
+            constexpr jint PUBLIC_META = 1 << 1;
+            constexpr jint PRIVATE_META = 1 << 2;
+            constexpr jint FILES = 1 << 3;
+            constexpr jint ALL = DATA | PUBLIC_META | PRIVATE_META | FILES;
+        }
+
         //Core
+        /**
+         * Converts PagingList to Java, converting its items with given converter.
+         */
+        template<typename T, typename Converter>
+        jobject pagingList2Java(
+                JniContextUtils &ctx,
+                privmx::endpoint::core::PagingList<T> &pagingList_c,
+                Converter convert
+        ) {
+            jclass pagingListCls = ctx.findClass(
+                    "com/simplito/kotlin/privmx_endpoint/model/PagingList");
+            jmethodID pagingListInitMID = ctx->GetMethodID(pagingListCls, "<init>",
+                                                           "(Ljava/lang/Long;Ljava/util/List;)V");
+            jobject items = ctx.vector2jList(pagingList_c.readItems, convert);
+            if (items == nullptr) {
+                return nullptr;
+            }
+            return ctx->NewObject(
+                    pagingListCls,
+                    pagingListInitMID,
+                    ctx.long2jLong(pagingList_c.totalAvailable),
+                    items);
+        }
+
         jobject
         itemPolicy2Java(
                 JniContextUtils &ctx,
@@ -52,6 +85,9 @@ namespace privmx {
                 privmx::endpoint::core::ContainerPolicy containerPolicy
         );
 
+        //Native memory
+        jobject nativeBuffer2Java(JniContextUtils &ctx, privmx::endpoint::core::Buffer buffer_c);
+
         //Context
         jobject context2Java(JniContextUtils &ctx, privmx::endpoint::core::Context context_c);
 
@@ -80,7 +116,16 @@ namespace privmx {
         jobject serverMessageInfo2Java(JniContextUtils &ctx,
                                        privmx::endpoint::thread::ServerMessageInfo serverMessageInfo_c);
 
-        jobject message2Java(JniContextUtils &ctx, privmx::endpoint::thread::Message message_c);
+        jobject message2Java(JniContextUtils &ctx,
+                             const privmx::endpoint::thread::Message &message_c,
+                             jint fields = projection::ALL);
+
+        jobject lazyFile2Java(JniContextUtils &ctx, privmx::endpoint::store::File file_c);
+
+        jobject lazyInboxEntry2Java(JniContextUtils &ctx,
+                                    privmx::endpoint::inbox::InboxEntry inboxEntry_c);
+
+        jobject lazyMessage2Java(JniContextUtils &ctx, privmx::endpoint::thread::Message message_c);
 
         //Store
         jobject store2Java(JniContextUtils &ctx, privmx::endpoint::store::Store store_c);
@@ -92,7 +137,9 @@ namespace privmx {
         jobject inbox2Java(JniContextUtils &ctx, privmx::endpoint::inbox::Inbox inbox_c);
 
         jobject
-        inboxEntry2Java(JniContextUtils &ctx, privmx::endpoint::inbox::InboxEntry inboxEntry_c);
+        inboxEntry2Java(JniContextUtils &ctx,
+                        const privmx::endpoint::inbox::InboxEntry &inboxEntry_c,
+                        jint fields = projection::ALL);
 
         jobject inboxPublicView2Java(JniContextUtils &ctx,
                                      privmx::endpoint::inbox::InboxPublicView inboxPublicView_c);
@@ -101,7 +148,9 @@ namespace privmx {
         jobject serverFileInfo2Java(JniContextUtils &ctx,
                                     privmx::endpoint::store::ServerFileInfo serverFileInfo_c);
 
-        jobject file2Java(JniContextUtils &ctx, privmx::endpoint::store::File file_c);
+        jobject file2Java(JniContextUtils &ctx,
+                          const privmx::endpoint::store::File &file_c,
+                          jint fields = projection::ALL);
 
         //Event
         jobject storeDeletedEventData2Java(JniContextUtils &ctx,
@@ -36,13 +36,13 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_BackendRequester_backendR
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &server_url, &method, &params_as_json, &access_token]() {
-                return ctx->NewStringUTF(
+                return ctx.string2jString(
                         privmx::endpoint::core::BackendRequester::backendRequest(
                                 ctx.jString2string(server_url),
                                 ctx.jString2string(access_token),
                                 ctx.jString2string(method),
                                 ctx.jString2string(params_as_json)
-                        ).c_str());
+                        ));
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -68,13 +68,12 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_BackendRequester_backendR
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &server_url, &method, &params_as_json]() {
-                return ctx->NewStringUTF(
+                return ctx.string2jString(
                         privmx::endpoint::core::BackendRequester::backendRequest(
                                 ctx.jString2string(server_url),
                                 ctx.jString2string(method),
                                 ctx.jString2string(params_as_json)
-                        ).c_str()
-                );
+                        ));
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -106,7 +105,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_BackendRequester_backendR
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &server_url, &method, &params_as_json, &api_key_id, &api_key_secret, &mode]() {
-                return ctx->NewStringUTF(
+                return ctx.string2jString(
                         privmx::endpoint::core::BackendRequester::backendRequest(
                                 ctx.jString2string(server_url),
                                 ctx.jString2string(api_key_id),
@@ -114,8 +113,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_BackendRequester_backendR
                                 mode,
                                 ctx.jString2string(method),
                                 ctx.jString2string(params_as_json)
-                        ).c_str()
-                );
+                        ));
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
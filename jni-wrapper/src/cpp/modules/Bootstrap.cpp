@@ -0,0 +1,323 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <mutex>
+#include <optional>
+#include <privmx/endpoint/core/Connection.hpp>
+#include <privmx/endpoint/thread/ThreadApi.hpp>
+#include <privmx/endpoint/store/StoreApi.hpp>
+#include <privmx/endpoint/inbox/InboxApi.hpp>
+#include "../utils.hpp"
+#include "../parser.h"
+#include "../model_native_initializers.h"
+#include "../executor.h"
+#include "../exceptions.h"
+
+using namespace privmx::endpoint;
+
+namespace {
+    // Connections and listings running at once within a single bootstrap
+    constexpr size_t BOOTSTRAP_MAX_THREADS = 16;
+
+    enum ContainerKind {
+        THREADS, STORES, INBOXES, CONTAINER_KINDS
+    };
+
+    struct Identity {
+        std::string userPrivKey;
+        std::string solutionId;
+        std::string bridgeUrl;
+        std::optional<core::PKIVerificationOptions> verificationOptions;
+    };
+
+    struct ContextSnapshot {
+        core::Context context;
+        core::PagingList<thread::Thread> threads;
+        core::PagingList<store::Store> stores;
+        core::PagingList<inbox::Inbox> inboxes;
+    };
+
+    struct IdentitySnapshot {
+        std::optional<core::Connection> connection;
+        std::optional<thread::ThreadApi> threadApi;
+        std::optional<store::StoreApi> storeApi;
+        std::optional<inbox::InboxApi> inboxApi;
+        std::vector<ContextSnapshot> contexts;
+        std::exception_ptr error;
+    };
+
+    Identity parseIdentity(JniContextUtils &ctx, jobject identity) {
+        jclass cls = ctx->GetObjectClass(identity);
+        auto field = [&ctx, &cls, &identity](const char *name, const char *signature) {
+            return ctx->GetObjectField(identity, ctx->GetFieldID(cls, name, signature));
+        };
+        Identity result;
+        result.userPrivKey = ctx.jString2string((jstring) field("userPrivKey", "Ljava/lang/String;"));
+        result.solutionId = ctx.jString2string((jstring) field("solutionId", "Ljava/lang/String;"));
+        result.bridgeUrl = ctx.jString2string((jstring) field("bridgeUrl", "Ljava/lang/String;"));
+        jobject verificationOptions = field(
+                "verificationOptions",
+                "Lcom/simplito/kotlin/privmx_endpoint/model/PKIVerificationOptions;");
+        if (verificationOptions != nullptr) {
+            result.verificationOptions = parsePKIVerificationOptions(ctx, verificationOptions);
+        }
+        ctx->DeleteLocalRef(cls);
+        return result;
+    }
+
+    core::PagingQuery firstPage(int64_t pageSize) {
+        core::PagingQuery query;
+        query.skip = 0;
+        query.limit = pageSize;
+        query.sortOrder = "desc";
+        return query;
+    }
+
+    void connectIdentity(const Identity &identity, int64_t pageSize, IdentitySnapshot &snapshot) {
+        core::Connection connection;
+        if (identity.verificationOptions.has_value()) {
+            connection = core::Connection::connect(
+                    identity.userPrivKey,
+                    identity.solutionId,
+                    identity.bridgeUrl,
+                    identity.verificationOptions.value());
+        } else {
+            connection = core::Connection::connect(
+                    identity.userPrivKey,
+                    identity.solutionId,
+                    identity.bridgeUrl);
+        }
+        snapshot.connection = connection;
+        snapshot.threadApi = thread::ThreadApi::create(connection);
+        snapshot.storeApi = store::StoreApi::create(connection);
+        snapshot.inboxApi = inbox::InboxApi::create(connection, *snapshot.threadApi, *snapshot.storeApi);
+        for (auto &context: connection.listContexts(firstPage(pageSize)).readItems) {
+            snapshot.contexts.push_back(ContextSnapshot{std::move(context), {}, {}, {}});
+        }
+    }
+
+    void listContainers(IdentitySnapshot &snapshot, ContextSnapshot &context, ContainerKind kind,
+                        int64_t pageSize) {
+        auto query = firstPage(pageSize);
+        switch (kind) {
+            case THREADS:
+                context.threads = snapshot.threadApi->listThreads(context.context.contextId, query);
+                break;
+            case STORES:
+                context.stores = snapshot.storeApi->listStores(context.context.contextId, query);
+                break;
+            case INBOXES:
+                context.inboxes = snapshot.inboxApi->listInboxes(context.context.contextId, query);
+                break;
+            default:
+                break;
+        }
+    }
+
+    /**
+     * Connects all identities at once, then lists containers of all their Contexts at once,
+     * so total time depends on the slowest connection rather than on the number of identities.
+     */
+    std::vector<IdentitySnapshot> bootstrap(
+            const std::vector<Identity> &identities,
+            int64_t pageSize,
+            const std::shared_ptr<privmx::wrapper::CancellationState> &token
+    ) {
+        std::vector<IdentitySnapshot> snapshots(identities.size());
+        std::mutex errorMutex;
+        auto fail = [&errorMutex](IdentitySnapshot &snapshot, std::exception_ptr error) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!snapshot.error) {
+                snapshot.error = error;
+            }
+        };
+        auto cancelled = [&token]() {
+            return token != nullptr && token->isCancelled();
+        };
+
+        privmx::wrapper::runParallel(identities.size(), BOOTSTRAP_MAX_THREADS, [&](size_t i) {
+            if (cancelled()) {
+                return;
+            }
+            try {
+                connectIdentity(identities[i], pageSize, snapshots[i]);
+            } catch (...) {
+                fail(snapshots[i], std::current_exception());
+            }
+        });
+
+        struct Listing {
+            size_t identity;
+            size_t context;
+            ContainerKind kind;
+        };
+        std::vector<Listing> listings;
+        for (size_t i = 0; i < snapshots.size(); ++i) {
+            if (snapshots[i].error) {
+                continue;
+            }
+            for (size_t c = 0; c < snapshots[i].contexts.size(); ++c) {
+                for (int kind = 0; kind < CONTAINER_KINDS; ++kind) {
+                    listings.push_back(Listing{i, c, (ContainerKind) kind});
+                }
+            }
+        }
+        privmx::wrapper::runParallel(listings.size(), BOOTSTRAP_MAX_THREADS, [&](size_t i) {
+            auto &snapshot = snapshots[listings[i].identity];
+            if (cancelled()) {
+                return;
+            }
+            try {
+                listContainers(snapshot, snapshot.contexts[listings[i].context], listings[i].kind, pageSize);
+            } catch (...) {
+                fail(snapshot, std::current_exception());
+            }
+        });
+
+        bool dropAll = cancelled();
+        for (auto &snapshot: snapshots) {
+            if ((dropAll || snapshot.error) && snapshot.connection.has_value()) {
+                try {
+                    snapshot.connection->disconnect();
+                } catch (...) {
+                }
+                snapshot.connection.reset();
+            }
+            snapshot.inboxApi.reset();
+            snapshot.storeApi.reset();
+            snapshot.threadApi.reset();
+            if (snapshot.error) {
+                snapshot.contexts.clear();
+            }
+        }
+        if (dropAll) {
+            throw CallCancelledException(token->deadlineExceeded());
+        }
+        return snapshots;
+    }
+
+    jobject contextSnapshot2Java(JniContextUtils &ctx, ContextSnapshot &snapshot) {
+        jclass contextSnapshotCls = ctx.findClass(
+                "com/simplito/kotlin/privmx_endpoint/model/ContextSnapshot");
+        jmethodID initMID = ctx->GetMethodID(
+                contextSnapshotCls,
+                "<init>",
+                "(Lcom/simplito/kotlin/privmx_endpoint/model/Context;"
+                "Lcom/simplito/kotlin/privmx_endpoint/model/PagingList;"
+                "Lcom/simplito/kotlin/privmx_endpoint/model/PagingList;"
+                "Lcom/simplito/kotlin/privmx_endpoint/model/PagingList;)V");
+        return ctx->NewObject(
+                contextSnapshotCls,
+                initMID,
+                privmx::wrapper::context2Java(ctx, snapshot.context),
+                privmx::wrapper::pagingList2Java(ctx, snapshot.threads, [&ctx](auto &thread_c) {
+                    return privmx::wrapper::thread2Java(ctx, thread_c);
+                }),
+                privmx::wrapper::pagingList2Java(ctx, snapshot.stores, [&ctx](auto &store_c) {
+                    return privmx::wrapper::store2Java(ctx, store_c);
+                }),
+                privmx::wrapper::pagingList2Java(ctx, snapshot.inboxes, [&ctx](auto &inbox_c) {
+                    return privmx::wrapper::inbox2Java(ctx, inbox_c);
+                }));
+    }
+
+    jobject identitySnapshot2Java(JniContextUtils &ctx, IdentitySnapshot &snapshot) {
+        jclass identitySnapshotCls = ctx.findClass(
+                "com/simplito/kotlin/privmx_endpoint/model/IdentitySnapshot");
+        jmethodID initMID = ctx->GetMethodID(
+                identitySnapshotCls,
+                "<init>",
+                "(Lcom/simplito/kotlin/privmx_endpoint/modules/core/Connection;"
+                "Ljava/util/List;Ljava/lang/Throwable;)V");
+        jobject connection = nullptr;
+        if (snapshot.connection.has_value()) {
+            jclass connectionCls = ctx.findClass(
+                    "com/simplito/kotlin/privmx_endpoint/modules/core/Connection");
+            jmethodID connectionInitMID = ctx->GetMethodID(
+                    connectionCls,
+                    "<init>",
+                    "(Ljava/lang/Long;)V");
+            auto *api = new core::Connection(snapshot.connection.value());
+            connection = ctx->NewObject(connectionCls, connectionInitMID, ctx.long2jLong((jlong) api));
+            if (connection == nullptr) {
+                delete api;
+                return nullptr;
+            }
+        }
+        jobject contexts = ctx.vector2jList(snapshot.contexts, [&ctx](auto &context) {
+            return contextSnapshot2Java(ctx, context);
+        });
+        if (contexts == nullptr) {
+            return nullptr;
+        }
+        jthrowable error = snapshot.error ? ctx.exception2jthrowable(snapshot.error) : nullptr;
+        return ctx->NewObject(identitySnapshotCls, initMID, connection, contexts, error);
+    }
+}
+
+extern "C" JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_bootstrapAsync(
+        JNIEnv *env,
+        jclass clazz,
+        jobject identities,
+        jlong page_size,
+        jobject token
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(identities, "Identities")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &clazz, &identities, &page_size, &token]() {
+                auto token_c = privmx::wrapper::getCancellationState(ctx, token);
+                jobjectArray identitiesArray = ctx.jObject2jArray(identities);
+                std::vector<Identity> identities_c;
+                identities_c.reserve(ctx->GetArrayLength(identitiesArray));
+                for (jsize i = 0; i < ctx->GetArrayLength(identitiesArray); ++i) {
+                    jobject identity = ctx->GetObjectArrayElement(identitiesArray, i);
+                    if (identity == nullptr) {
+                        throw IllegalStateException("Identity cannot be null");
+                    }
+                    identities_c.push_back(parseIdentity(ctx, identity));
+                    ctx->DeleteLocalRef(identity);
+                }
+                int64_t pageSize_c = page_size;
+                return ctx.callAsyncEndpointApi(
+                        clazz,
+                        token_c,
+                        [identities_c, pageSize_c, token_c]() {
+                            return bootstrap(identities_c, pageSize_c, token_c);
+                        },
+                        [](JniContextUtils &ctx, std::vector<IdentitySnapshot> &snapshots) -> jobject {
+                            JniContextUtils::StringInterningScope stringInterning(ctx);
+                            jclass bootstrapSnapshotCls = ctx.findClass(
+                                    "com/simplito/kotlin/privmx_endpoint/model/BootstrapSnapshot");
+                            jmethodID initMID = ctx->GetMethodID(
+                                    bootstrapSnapshotCls,
+                                    "<init>",
+                                    "(Ljava/util/List;)V");
+                            jobject identities = ctx.vector2jList(snapshots, [&ctx](auto &snapshot) {
+                                return identitySnapshot2Java(ctx, snapshot);
+                            });
+                            if (identities == nullptr) {
+                                return nullptr;
+                            }
+                            return ctx->NewObject(bootstrapSnapshotCls, initMID, identities);
+                        });
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
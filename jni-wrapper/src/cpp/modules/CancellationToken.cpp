@@ -0,0 +1,79 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <chrono>
+#include "../utils.hpp"
+#include "../cancellation.h"
+
+using privmx::wrapper::CancellationState;
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_CancellationToken_create(
+        JNIEnv *env,
+        jclass clazz,
+        jlong timeout_millis
+) {
+    JniContextUtils ctx(env);
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &clazz, &timeout_millis]() {
+        std::optional<CancellationState::Clock::time_point> deadline;
+        if (timeout_millis >= 0) {
+            deadline = CancellationState::Clock::now() + std::chrono::milliseconds(timeout_millis);
+        }
+        return (jlong) new std::shared_ptr<CancellationState>(
+                CancellationState::create(ctx, clazz, deadline));
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_CancellationToken_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    JniContextUtils ctx(env);
+    auto state = (std::shared_ptr<CancellationState> *) ptr;
+    (*state)->release(ctx);
+    delete state;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_CancellationToken_cancel(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    ctx.callVoidEndpointApi([&ctx, &thiz]() {
+        privmx::wrapper::getCancellationState(ctx, thiz)->cancel(ctx);
+    });
+}
+
+extern "C"
+JNIEXPORT jboolean JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_CancellationToken_isCancelledNative(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    jboolean result = JNI_FALSE;
+    ctx.callResultEndpointApi<jboolean>(&result, [&ctx, &thiz]() {
+        return (jboolean) privmx::wrapper::getCancellationState(ctx, thiz)->isCancelled();
+    });
+    return result;
+}
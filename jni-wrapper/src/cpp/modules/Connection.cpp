@@ -47,59 +47,29 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_deinit(JNIEnv
     }
 }
 
-extern "C" JNIEXPORT jobject JNICALL
-Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_listContexts(
+static jobject listContexts(
         JNIEnv *env,
         jobject thiz,
-        jlong skip,
-        jlong limit,
-        jstring sort_order,
-        jstring last_id,
-        jstring query_as_json
+        const PagingQueryArgs &paging
 ) {
     JniContextUtils ctx(env);
-    if (ctx.nullCheck(sort_order, "Sort Order")) {
+    if (paging.nullCheck(ctx)) {
         return nullptr;
     }
     jobject result;
     ctx.callResultEndpointApi<jobject>(
             &result,
-            [&ctx, &env, &thiz, &skip, &limit, &sort_order, &last_id, &query_as_json]() {
-                auto query = privmx::endpoint::core::PagingQuery();
-                query.skip = skip;
-                query.limit = limit;
-                query.sortOrder = ctx.jString2string(sort_order);
-                if (last_id != nullptr) {
-                    query.lastId = ctx.jString2string(last_id);
-                }
-                if (query_as_json != nullptr) {
-                    query.queryAsJson = ctx.jString2string(query_as_json);
-                }
+            [&ctx, &env, &thiz, &paging]() {
+                auto query = paging.toPagingQuery(ctx);
                 privmx::endpoint::core::PagingList<privmx::endpoint::core::Context> infos = getConnection(
                         env, thiz)->listContexts(query);
-                jclass pagingListCls = env->FindClass(
-                        "com/simplito/kotlin/privmx_endpoint/model/PagingList");
-                jmethodID pagingListInitMID = env->GetMethodID(
-                        pagingListCls,
-                        "<init>",
-                        "(Ljava/lang/Long;Ljava/util/List;)V");
-                jclass arrayListCls = env->FindClass("java/util/ArrayList");
-                jmethodID initMID = env->GetMethodID(arrayListCls, "<init>", "()V");
-                jmethodID addToListMID = env->GetMethodID(arrayListCls,
-                                                          "add",
-                                                          "(Ljava/lang/Object;)Z");
-                jobject array = env->NewObject(arrayListCls, initMID);
-                for (auto &context: infos.readItems) {
-                    env->CallBooleanMethod(
-                            array,
-                            addToListMID,
-                            privmx::wrapper::context2Java(ctx, context));
-                }
-                return ctx->NewObject(
-                        pagingListCls,
-                        pagingListInitMID,
-                        ctx.long2jLong(infos.totalAvailable),
-                        array);
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return privmx::wrapper::pagingList2Java(
+                        ctx,
+                        infos,
+                        [&ctx](auto &context) {
+                            return privmx::wrapper::context2Java(ctx, context);
+                        });
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -107,6 +77,33 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_listContexts(
     return result;
 }
 
+extern "C" JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_listContexts(
+        JNIEnv *env,
+        jobject thiz,
+        jlong skip,
+        jlong limit,
+        jstring sort_order,
+        jstring last_id,
+        jstring query_as_json
+) {
+    return listContexts(env, thiz,
+                        PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json));
+}
+
+extern "C" JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_listContextsPrepared(
+        JNIEnv *env,
+        jobject thiz,
+        jlong skip,
+        jlong limit,
+        jobject prepared_query,
+        jstring last_id
+) {
+    return listContexts(env, thiz,
+                        PagingQueryArgs::prepared(skip, limit, prepared_query, last_id));
+}
+
 extern "C" JNIEXPORT void JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_disconnect(
         JNIEnv *env,
@@ -186,6 +183,82 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_connect(
     return result;
 }
 extern "C" JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_connectAsync(
+        JNIEnv *env,
+        jclass clazz,
+        jstring user_priv_key,
+        jstring solution_id,
+        jstring bridge_url,
+        jobject pki_verification_options,
+        jobject token
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(user_priv_key, "User Private Key") ||
+        ctx.nullCheck(solution_id, "Solution ID") ||
+        ctx.nullCheck(bridge_url, "Bridge URL")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &clazz, &user_priv_key, &solution_id, &bridge_url, &pki_verification_options, &token]() {
+                auto token_c = privmx::wrapper::getCancellationState(ctx, token);
+                auto userPrivKey_c = ctx.jString2string(user_priv_key);
+                auto solutionId_c = ctx.jString2string(solution_id);
+                auto bridgeUrl_c = ctx.jString2string(bridge_url);
+                std::optional<privmx::endpoint::core::PKIVerificationOptions> verificationOptions_c;
+                if (pki_verification_options != nullptr) {
+                    verificationOptions_c = parsePKIVerificationOptions(ctx, pki_verification_options);
+                }
+                return ctx.callAsyncEndpointApi(
+                        clazz,
+                        token_c,
+                        [userPrivKey_c, solutionId_c, bridgeUrl_c, verificationOptions_c, token_c]() {
+                            privmx::endpoint::core::Connection connection;
+                            if (verificationOptions_c.has_value()) {
+                                connection = privmx::endpoint::core::Connection::connect(
+                                        userPrivKey_c,
+                                        solutionId_c,
+                                        bridgeUrl_c,
+                                        verificationOptions_c.value());
+                            } else {
+                                connection = privmx::endpoint::core::Connection::connect(
+                                        userPrivKey_c,
+                                        solutionId_c,
+                                        bridgeUrl_c);
+                            }
+                            // Nobody would close the connection of a cancelled call
+                            if (token_c != nullptr && token_c->isCancelled()) {
+                                connection.disconnect();
+                                throw CallCancelledException(token_c->deadlineExceeded());
+                            }
+                            return connection;
+                        },
+                        [](JniContextUtils &ctx, privmx::endpoint::core::Connection &connection) {
+                            jclass connectionCls = ctx.findClass(
+                                    "com/simplito/kotlin/privmx_endpoint/modules/core/Connection");
+                            jmethodID initMID = ctx->GetMethodID(
+                                    connectionCls,
+                                    "<init>",
+                                    "(Ljava/lang/Long;)V");
+                            auto *api = new privmx::endpoint::core::Connection();
+                            *api = connection;
+                            jobject result = ctx->NewObject(
+                                    connectionCls,
+                                    initMID,
+                                    ctx.long2jLong((jlong) api));
+                            if (result == nullptr) {
+                                delete api;
+                            }
+                            return result;
+                        });
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+extern "C" JNIEXPORT jobject JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_connectPublic(
         JNIEnv *env,
         jclass clazz,
@@ -284,28 +357,14 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_Connection_getContextUser
     ctx.callResultEndpointApi<jobject>(
             &result,
             [&ctx, &env, &thiz, &context_id]() {
-
-                jclass arrayListCls = env->FindClass("java/util/ArrayList");
-                jmethodID initMID = env->GetMethodID(arrayListCls, "<init>", "()V");
-                jmethodID addToListMID = env->GetMethodID(arrayListCls, "add",
-                                                          "(Ljava/lang/Object;)Z");
-                jobject array = env->NewObject(arrayListCls, initMID);
-
-
                 std::vector<privmx::endpoint::core::UserInfo> users = getConnection(
                         env,
                         thiz
                 )->getContextUsers(ctx.jString2string(context_id));
 
-                for (auto &user: users) {
-                    env->CallBooleanMethod(
-                            array,
-                            addToListMID,
-                            privmx::wrapper::userInfo2Java(ctx, user)
-                    );
-                }
-
-                return array;
+                return ctx.vector2jList(users, [&ctx](auto &user) {
+                    return privmx::wrapper::userInfo2Java(ctx, user);
+                });
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -10,11 +10,28 @@
 //
 
 #include <jni.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+#include <openssl/evp.h>
 #include <privmx/endpoint/core/Exception.hpp>
 #include <privmx/endpoint/crypto/CryptoApi.hpp>
+#include "CryptoApi.h"
+#include "ExtKey.h"
 #include "../utils.hpp"
 #include "../parser.h"
 #include "../exceptions.h"
+#include "../executor.h"
+#include "../secure.h"
 
 using namespace privmx::endpoint;
 
@@ -28,6 +45,13 @@ crypto::CryptoApi *getCryptoApi(JniContextUtils &ctx, jobject thiz) {
     return (crypto::CryptoApi *) ctx.getObject(apiLong).getLongValue();
 }
 
+namespace {
+    // Core API takes key material as Buffer, so the secret is copied to the heap for the call
+    core::Buffer secretBuffer(const privmx::wrapper::Secret &secret) {
+        return core::Buffer::from((const char *) secret.data(), secret.size());
+    }
+}
+
 
 extern "C"
 JNIEXPORT jobject JNICALL
@@ -79,13 +103,14 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_generatePriva
             [&ctx, &thiz, &random_seed]() {
                 std::optional<std::string> random_seed_c = std::nullopt;
                 if (random_seed != nullptr) {
-                    random_seed_c = ctx.jString2string(random_seed);
+                    random_seed_c = ctx.jString2secret(random_seed).str();
                 }
-                return ctx->NewStringUTF(
+                privmx::wrapper::ScopedWipe wipeRandomSeed(random_seed_c);
+                privmx::wrapper::SecretString privateKey(
                         getCryptoApi(ctx, thiz)->generatePrivateKey(
                                 random_seed_c
-                        ).c_str()
-                );
+                        ));
+                return ctx.secret2jString(privateKey.str());
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -107,10 +132,10 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_derivePublicK
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &thiz, &private_key]() {
-                return ctx->NewStringUTF(
+                return ctx.string2jString(
                         getCryptoApi(ctx, thiz)->derivePublicKey(
-                                ctx.jString2string(private_key)
-                        ).c_str());
+                                ctx.jString2secret(private_key).str()
+                        ));
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -136,7 +161,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_encryptDataSy
             [&ctx, &thiz, &data, &symmetric_key]() {
                 auto response = getCryptoApi(ctx, thiz)->encryptDataSymmetric(
                         core::Buffer::from(ctx.jByteArray2String(data)),
-                        core::Buffer::from(ctx.jByteArray2String(symmetric_key)));
+                        secretBuffer(ctx.jByteArray2secret(symmetric_key)));
                 jbyteArray result = ctx->NewByteArray(response.size());
                 ctx->SetByteArrayRegion(result, 0, response.size(), (jbyte *) response.data());
                 return result;
@@ -165,7 +190,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_decryptDataSy
             [&ctx, &thiz, &data, &symmetric_key]() {
                 auto response = getCryptoApi(ctx, thiz)->decryptDataSymmetric(
                         core::Buffer::from(ctx.jByteArray2String(data)),
-                        core::Buffer::from(ctx.jByteArray2String(symmetric_key))
+                        secretBuffer(ctx.jByteArray2secret(symmetric_key))
                 );
                 jbyteArray result = ctx->NewByteArray(response.size());
                 ctx->SetByteArrayRegion(result, 0, response.size(), (jbyte *) response.data());
@@ -177,6 +202,241 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_decryptDataSy
     return result;
 }
 
+namespace {
+    // Batches smaller than this are processed on the calling thread only
+    constexpr size_t PARALLEL_BATCH_MIN_BYTES = 64 * 1024;
+    // Signature batches smaller than this are verified on the calling thread only
+    constexpr size_t PARALLEL_VERIFY_MIN_ITEMS = 8;
+
+    std::vector<core::Buffer> jList2Buffers(JniContextUtils &ctx, jobject list, const char *name) {
+        jobjectArray array = ctx.jObject2jArray(list);
+        jsize size = ctx->GetArrayLength(array);
+        std::vector<core::Buffer> result;
+        result.reserve(size);
+        for (jsize i = 0; i < size; ++i) {
+            auto element = (jbyteArray) ctx->GetObjectArrayElement(array, i);
+            if (element == nullptr) {
+                throw std::invalid_argument(std::string(name) + " cannot be null");
+            }
+            result.push_back(core::Buffer::from(ctx.jByteArray2String(element)));
+            ctx->DeleteLocalRef(element);
+        }
+        ctx->DeleteLocalRef(array);
+        return result;
+    }
+
+    std::vector<core::Buffer> jList2SecretBuffers(JniContextUtils &ctx, jobject list, const char *name) {
+        jobjectArray array = ctx.jObject2jArray(list);
+        jsize size = ctx->GetArrayLength(array);
+        std::vector<core::Buffer> result;
+        result.reserve(size);
+        for (jsize i = 0; i < size; ++i) {
+            auto element = (jbyteArray) ctx->GetObjectArrayElement(array, i);
+            if (element == nullptr) {
+                throw std::invalid_argument(std::string(name) + " cannot be null");
+            }
+            result.push_back(secretBuffer(ctx.jByteArray2secret(element)));
+            ctx->DeleteLocalRef(element);
+        }
+        ctx->DeleteLocalRef(array);
+        return result;
+    }
+
+    std::vector<std::string> jList2Strings(JniContextUtils &ctx, jobject list, const char *name) {
+        jobjectArray array = ctx.jObject2jArray(list);
+        jsize size = ctx->GetArrayLength(array);
+        std::vector<std::string> result;
+        result.reserve(size);
+        for (jsize i = 0; i < size; ++i) {
+            auto element = (jstring) ctx->GetObjectArrayElement(array, i);
+            if (element == nullptr) {
+                throw std::invalid_argument(std::string(name) + " cannot be null");
+            }
+            result.push_back(ctx.jString2string(element));
+            ctx->DeleteLocalRef(element);
+        }
+        ctx->DeleteLocalRef(array);
+        return result;
+    }
+
+    /**
+     * Encrypts or decrypts each data buffer with the key at the same index (or the only key),
+     * spreading items over available cores. Returns results in input order.
+     */
+    jobject symmetricBatch(
+            JNIEnv *env,
+            jobject thiz,
+            jobject data,
+            jobject symmetric_keys,
+            bool encrypt
+    ) {
+        JniContextUtils ctx(env);
+        if (ctx.nullCheck(data, "Data") ||
+            ctx.nullCheck(symmetric_keys, "Symmetric keys")) {
+            return nullptr;
+        }
+        jobject result;
+        ctx.callResultEndpointApi<jobject>(
+                &result,
+                [&ctx, &thiz, &data, &symmetric_keys, encrypt]() {
+                    auto api = getCryptoApi(ctx, thiz);
+                    auto data_c = jList2Buffers(ctx, data, "Data");
+                    auto keys_c = jList2SecretBuffers(ctx, symmetric_keys, "Symmetric key");
+                    if (keys_c.size() != 1 && keys_c.size() != data_c.size()) {
+                        throw std::invalid_argument("Expected one symmetric key or one key for each data buffer");
+                    }
+                    size_t totalBytes = 0;
+                    for (auto &buffer: data_c) {
+                        totalBytes += buffer.size();
+                    }
+                    size_t maxThreads = totalBytes < PARALLEL_BATCH_MIN_BYTES
+                                        ? 1
+                                        : std::max(1u, std::thread::hardware_concurrency());
+                    std::vector<core::Buffer> results_c(data_c.size());
+                    std::vector<std::exception_ptr> errors(data_c.size());
+                    privmx::wrapper::runParallel(data_c.size(), maxThreads, [&](size_t i) {
+                        try {
+                            auto &key = keys_c.size() == 1 ? keys_c[0] : keys_c[i];
+                            results_c[i] = encrypt
+                                           ? api->encryptDataSymmetric(data_c[i], key)
+                                           : api->decryptDataSymmetric(data_c[i], key);
+                        } catch (...) {
+                            errors[i] = std::current_exception();
+                        }
+                        // Release input as soon as it is processed
+                        data_c[i] = core::Buffer();
+                    });
+                    for (auto &error: errors) {
+                        if (error) {
+                            std::rethrow_exception(error);
+                        }
+                    }
+                    return ctx.vector2jList(results_c, [&ctx](core::Buffer &buffer) -> jobject {
+                        jbyteArray array = ctx->NewByteArray(buffer.size());
+                        ctx->SetByteArrayRegion(array, 0, buffer.size(), (jbyte *) buffer.data());
+                        return array;
+                    });
+                });
+        if (ctx->ExceptionCheck()) {
+            return nullptr;
+        }
+        return result;
+    }
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_encryptBatch(
+        JNIEnv *env,
+        jobject thiz,
+        jobject data,
+        jobject symmetric_keys
+) {
+    return symmetricBatch(env, thiz, data, symmetric_keys, true);
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_decryptBatch(
+        JNIEnv *env,
+        jobject thiz,
+        jobject data,
+        jobject symmetric_keys
+) {
+    return symmetricBatch(env, thiz, data, symmetric_keys, false);
+}
+
+extern "C"
+JNIEXPORT jbooleanArray JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_verifyBatch(
+        JNIEnv *env,
+        jobject thiz,
+        jobject data,
+        jobject signatures,
+        jobject public_keys
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(data, "Data") ||
+        ctx.nullCheck(signatures, "Signatures") ||
+        ctx.nullCheck(public_keys, "Public keys")) {
+        return nullptr;
+    }
+    jbooleanArray result;
+    ctx.callResultEndpointApi<jbooleanArray>(
+            &result,
+            [&ctx, &thiz, &data, &signatures, &public_keys]() {
+                auto api = getCryptoApi(ctx, thiz);
+                auto data_c = jList2Buffers(ctx, data, "Data");
+                auto signatures_c = jList2Buffers(ctx, signatures, "Signature");
+                auto keys_c = jList2Strings(ctx, public_keys, "Public key");
+                if (signatures_c.size() != data_c.size()) {
+                    throw std::invalid_argument("Expected one signature for each data buffer");
+                }
+                if (keys_c.size() != 1 && keys_c.size() != data_c.size()) {
+                    throw std::invalid_argument("Expected one public key or one key for each data buffer");
+                }
+                size_t maxThreads = data_c.size() < PARALLEL_VERIFY_MIN_ITEMS
+                                    ? 1
+                                    : std::max(1u, std::thread::hardware_concurrency());
+                // Not std::vector<bool>, as its elements cannot be written from several threads
+                std::vector<jboolean> results_c(data_c.size(), JNI_FALSE);
+                std::vector<std::exception_ptr> errors(data_c.size());
+                privmx::wrapper::runParallel(data_c.size(), maxThreads, [&](size_t i) {
+                    try {
+                        auto &key = keys_c.size() == 1 ? keys_c[0] : keys_c[i];
+                        results_c[i] = api->verifySignature(data_c[i], signatures_c[i], key)
+                                       ? JNI_TRUE
+                                       : JNI_FALSE;
+                    } catch (...) {
+                        errors[i] = std::current_exception();
+                    }
+                });
+                for (auto &error: errors) {
+                    if (error) {
+                        std::rethrow_exception(error);
+                    }
+                }
+                jbooleanArray array = ctx->NewBooleanArray((jsize) results_c.size());
+                ctx->SetBooleanArrayRegion(array, 0, (jsize) results_c.size(), results_c.data());
+                return array;
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_decryptDataSymmetricDirect(
+        JNIEnv *env,
+        jobject thiz,
+        jbyteArray data,
+        jbyteArray symmetric_key
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(data, "Data") ||
+        ctx.nullCheck(symmetric_key, "Symmetric key")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &data, &symmetric_key]() {
+                return privmx::wrapper::nativeBuffer2Java(
+                        ctx,
+                        getCryptoApi(ctx, thiz)->decryptDataSymmetric(
+                                core::Buffer::from(ctx.jByteArray2String(data)),
+                                secretBuffer(ctx.jByteArray2secret(symmetric_key))
+                        )
+                );
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
 extern "C"
 JNIEXPORT jbyteArray JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_signData(
@@ -196,7 +456,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_signData(
             [&ctx, &thiz, &data, &private_key]() {
                 auto response = getCryptoApi(ctx, thiz)->signData(
                         core::Buffer::from(ctx.jByteArray2String(data)),
-                        ctx.jString2string(private_key)
+                        ctx.jString2secret(private_key).str()
                 );
 
                 jbyteArray result = ctx->NewByteArray(response.size());
@@ -224,9 +484,9 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_convertPEMKey
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &thiz, &pem_key]() {
-                std::string convertedKey = getCryptoApi(ctx, thiz)->convertPEMKeytoWIFKey(
-                        ctx.jString2string(pem_key));
-                return ctx->NewStringUTF(convertedKey.c_str());
+                privmx::wrapper::SecretString convertedKey(getCryptoApi(ctx, thiz)->convertPEMKeytoWIFKey(
+                        ctx.jString2secret(pem_key).str()));
+                return ctx.secret2jString(convertedKey.str());
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -250,11 +510,11 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_derivePrivate
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &thiz, &password, &salt]() {
-                auto result = getCryptoApi(ctx, thiz)->derivePrivateKey(
-                        ctx.jString2string(password),
-                        ctx.jString2string(salt)
-                );
-                return ctx->NewStringUTF(result.c_str());
+                privmx::wrapper::SecretString result(getCryptoApi(ctx, thiz)->derivePrivateKey(
+                        ctx.jString2secret(password).str(),
+                        ctx.jString2secret(salt).str()
+                ));
+                return ctx.secret2jString(result.str());
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -278,11 +538,11 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_derivePrivate
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &thiz, &password, &salt]() {
-                auto result = getCryptoApi(ctx, thiz)->derivePrivateKey2(
-                        ctx.jString2string(password),
-                        ctx.jString2string(salt)
-                );
-                return ctx->NewStringUTF(result.c_str());
+                privmx::wrapper::SecretString result(getCryptoApi(ctx, thiz)->derivePrivateKey2(
+                        ctx.jString2secret(password).str(),
+                        ctx.jString2secret(salt).str()
+                ));
+                return ctx.secret2jString(result.str());
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -357,7 +617,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_convertPGPAsn
             [&ctx, &thiz, &pgp_key]() {
                 std::string key = getCryptoApi(ctx, thiz)->convertPGPAsn1KeyToBase58DERKey(
                         ctx.jString2string(pgp_key));
-                return ctx->NewStringUTF(key.c_str());
+                return ctx.string2jString(key);
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -377,9 +637,9 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_entropyToMnem
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &thiz, &entropy]() {
-                std::string entropy_n = getCryptoApi(ctx, thiz)->entropyToMnemonic(
-                        core::Buffer::from(ctx.jByteArray2String(entropy)));
-                return ctx->NewStringUTF(entropy_n.c_str());
+                privmx::wrapper::SecretString mnemonic(getCryptoApi(ctx, thiz)->entropyToMnemonic(
+                        secretBuffer(ctx.jByteArray2secret(entropy))));
+                return ctx.secret2jString(mnemonic.str());
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -399,14 +659,14 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_mnemonicToEnt
     ctx.callResultEndpointApi<jbyteArray>(
             &result,
             [&ctx, &thiz, &mnemonic]() {
-                std::string entropy = getCryptoApi(ctx, thiz)->mnemonicToEntropy(
-                        ctx.jString2string(mnemonic)).stdString();
-                jbyteArray array = ctx->NewByteArray(entropy.length());
+                privmx::wrapper::SecretString entropy(getCryptoApi(ctx, thiz)->mnemonicToEntropy(
+                        ctx.jString2secret(mnemonic).str()).stdString());
+                jbyteArray array = ctx->NewByteArray(entropy.str().length());
                 ctx->SetByteArrayRegion(
                         array,
                         0,
-                        entropy.length(),
-                        (jbyte *) entropy.c_str()
+                        entropy.str().length(),
+                        (jbyte *) entropy.str().c_str()
                 );
                 return array;
             }
@@ -436,7 +696,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_generateBip39
                 } else {
                     bip39 = getCryptoApi(ctx, thiz)->generateBip39(
                             strength,
-                            ctx.jString2string(password));
+                            ctx.jString2secret(password).str());
                 }
 
                 return privmx::wrapper::BIP392Java(ctx, bip39);
@@ -465,11 +725,11 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_fromMnemonic(
 
                 if (password == nullptr) {
                     bip39 = getCryptoApi(ctx, thiz)->fromMnemonic(
-                            ctx.jString2string(mnemonic));
+                            ctx.jString2secret(mnemonic).str());
                 } else {
                     bip39 = getCryptoApi(ctx, thiz)->fromMnemonic(
-                            ctx.jString2string(mnemonic),
-                            ctx.jString2string(password));
+                            ctx.jString2secret(mnemonic).str(),
+                            ctx.jString2secret(password).str());
                 }
 
                 return privmx::wrapper::BIP392Java(ctx, bip39);
@@ -498,11 +758,11 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_fromEntropy(J
 
                 if (password == nullptr) {
                     bip39 = getCryptoApi(ctx, thiz)->fromEntropy(
-                            core::Buffer::from(ctx.jByteArray2String(entropy)));
+                            secretBuffer(ctx.jByteArray2secret(entropy)));
                 } else {
                     bip39 = getCryptoApi(ctx, thiz)->fromEntropy(
-                            core::Buffer::from(ctx.jByteArray2String(entropy)),
-                            ctx.jString2string(password));
+                            secretBuffer(ctx.jByteArray2secret(entropy)),
+                            ctx.jString2secret(password).str());
                 }
 
                 return privmx::wrapper::BIP392Java(ctx, bip39);
@@ -527,23 +787,23 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_mnemonicToSee
     ctx.callResultEndpointApi<jbyteArray>(
             &result,
             [&ctx, &thiz, &mnemonic, &password]() {
-                std::string seed;
+                privmx::wrapper::SecretString seed;
 
                 if (password == nullptr) {
-                    seed = getCryptoApi(ctx, thiz)->mnemonicToSeed(
-                            ctx.jString2string(mnemonic)).stdString();
+                    seed = privmx::wrapper::SecretString(getCryptoApi(ctx, thiz)->mnemonicToSeed(
+                            ctx.jString2secret(mnemonic).str()).stdString());
                 } else {
-                    seed = getCryptoApi(ctx, thiz)->mnemonicToSeed(
-                            ctx.jString2string(mnemonic),
-                            ctx.jString2string(password)).stdString();
+                    seed = privmx::wrapper::SecretString(getCryptoApi(ctx, thiz)->mnemonicToSeed(
+                            ctx.jString2secret(mnemonic).str(),
+                            ctx.jString2secret(password).str()).stdString());
                 }
 
-                jbyteArray array = ctx->NewByteArray(seed.length());
+                jbyteArray array = ctx->NewByteArray(seed.str().length());
                 ctx->SetByteArrayRegion(
                         array,
                         0,
-                        seed.length(),
-                        (jbyte *) seed.c_str()
+                        seed.str().length(),
+                        (jbyte *) seed.str().c_str()
                 );
                 return array;
             }
@@ -552,4 +812,340 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_mnemonicToSee
         return nullptr;
     }
     return result;
+}
+
+namespace {
+    /**
+     * Results of slow key derivations kept for a short time, keyed by SHA-256 of their inputs,
+     * so repeated derivations with the same inputs (e.g. login retries) are not recomputed.
+     * Disabled until enabled with CryptoApi.setKdfCache; used by the async derivation variants only.
+     */
+    class KdfCache {
+    public:
+        using Value = std::variant<core::Buffer, std::string, crypto::BIP39_t>;
+
+        static KdfCache &instance() {
+            static KdfCache cache;
+            return cache;
+        }
+
+        /**
+         * Builds cache key from derivation kind and its inputs; absent (null) inputs differ from empty ones.
+         */
+        static std::string key(char kind, std::initializer_list<const privmx::wrapper::SecretString *> inputs) {
+            EVP_MD_CTX *md = EVP_MD_CTX_new();
+            if (md == nullptr || EVP_DigestInit_ex(md, EVP_sha256(), nullptr) != 1) {
+                EVP_MD_CTX_free(md);
+                throw std::runtime_error("Cannot initialize digest");
+            }
+            EVP_DigestUpdate(md, &kind, 1);
+            for (auto input: inputs) {
+                unsigned char present = input != nullptr ? 1 : 0;
+                uint64_t size = present ? input->str().size() : 0;
+                EVP_DigestUpdate(md, &present, 1);
+                EVP_DigestUpdate(md, &size, sizeof(size));
+                if (present) {
+                    EVP_DigestUpdate(md, input->str().data(), input->str().size());
+                }
+            }
+            unsigned char digest[EVP_MAX_MD_SIZE];
+            unsigned int digestSize = 0;
+            int finished = EVP_DigestFinal_ex(md, digest, &digestSize);
+            EVP_MD_CTX_free(md);
+            if (finished != 1) {
+                throw std::runtime_error("Cannot compute digest");
+            }
+            return std::string((const char *) digest, digestSize);
+        }
+
+        void configure(std::chrono::milliseconds ttl, size_t maxEntries) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _ttl = ttl;
+            _maxEntries = maxEntries;
+            if (!enabled()) {
+                for (auto &entry: _entries) {
+                    wipe(entry.second.value);
+                }
+                _entries.clear();
+            }
+        }
+
+        std::optional<Value> get(const std::string &key) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _entries.find(key);
+            if (it == _entries.end()) {
+                return std::nullopt;
+            }
+            if (it->second.expires <= Clock::now()) {
+                wipe(it->second.value);
+                _entries.erase(it);
+                return std::nullopt;
+            }
+            return it->second.value;
+        }
+
+        bool isEnabled() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return enabled();
+        }
+
+        /**
+         * Takes value over; a value that is not stored (cache disabled meanwhile) is wiped.
+         */
+        void put(const std::string &key, Value &&value) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!enabled()) {
+                wipe(value);
+                return;
+            }
+            auto existing = _entries.find(key);
+            if (existing != _entries.end()) {
+                wipe(existing->second.value);
+                _entries.erase(existing);
+            }
+            auto now = Clock::now();
+            if (_entries.size() >= _maxEntries) {
+                removeExpired(now);
+            }
+            while (_entries.size() >= _maxEntries) {
+                auto oldest = std::min_element(_entries.begin(), _entries.end(), [](auto &a, auto &b) {
+                    return a.second.expires < b.second.expires;
+                });
+                wipe(oldest->second.value);
+                _entries.erase(oldest);
+            }
+            _entries.emplace(key, Entry{std::move(value), now + _ttl});
+        }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Entry {
+            Value value;
+            Clock::time_point expires;
+        };
+
+        bool enabled() const {
+            return _ttl.count() > 0 && _maxEntries > 0;
+        }
+
+        void removeExpired(Clock::time_point now) {
+            for (auto it = _entries.begin(); it != _entries.end();) {
+                if (it->second.expires <= now) {
+                    wipe(it->second.value);
+                    it = _entries.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        // Buffers and BIP39 keys are owned by the core library and cannot be wiped from here
+        static void wipe(Value &value) {
+            if (auto string = std::get_if<std::string>(&value)) {
+                privmx::wrapper::secureZero(string->data(), string->size());
+            }
+        }
+
+        std::mutex _mutex;
+        std::unordered_map<std::string, Entry> _entries;
+        std::chrono::milliseconds _ttl{0};
+        size_t _maxEntries = 0;
+    };
+
+    // Secret captured by async tasks. Copies of std::function share it, so it is wiped with the last one.
+    using SharedSecret = std::shared_ptr<const privmx::wrapper::SecretString>;
+
+    // Returns nullptr for null value
+    SharedSecret sharedSecret(JniContextUtils &ctx, jstring value) {
+        if (value == nullptr) {
+            return nullptr;
+        }
+        return std::make_shared<const privmx::wrapper::SecretString>(ctx.jString2secret(value));
+    }
+
+    /**
+     * Runs derivation on the compute pool, returning java.util.concurrent.CompletableFuture
+     * completed with its result converted by convert. Results are served from and stored in KdfCache.
+     */
+    template<typename T, typename Derive, typename Convert>
+    jobject deriveAsync(
+            JniContextUtils &ctx,
+            jobject thiz,
+            jobject token,
+            std::string cacheKey,
+            Derive &&derive,
+            Convert &&convert
+    ) {
+        auto token_c = privmx::wrapper::getCancellationState(ctx, token);
+        return ctx.callAsyncEndpointApi(
+                ctx->GetObjectClass(thiz),
+                token_c,
+                [cacheKey = std::move(cacheKey), derive = std::forward<Derive>(derive)]() mutable -> T {
+                    auto &cache = KdfCache::instance();
+                    if (!cache.isEnabled()) {
+                        return derive();
+                    }
+                    if (auto cached = cache.get(cacheKey)) {
+                        return std::get<T>(std::move(*cached));
+                    }
+                    T result = derive();
+                    // The cache owns its own copy, moved in so no unwiped temporary is left behind
+                    KdfCache::Value cachedCopy(result);
+                    cache.put(cacheKey, std::move(cachedCopy));
+                    return result;
+                },
+                std::forward<Convert>(convert),
+                privmx::wrapper::NativeExecutor::compute());
+    }
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_setKdfCache(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ttl_millis,
+        jint max_entries
+) {
+    JniContextUtils ctx(env);
+    ctx.callVoidEndpointApi([ttl_millis, max_entries]() {
+        if (ttl_millis < 0 || max_entries < 0) {
+            throw std::invalid_argument("TTL and max entries cannot be negative");
+        }
+        KdfCache::instance().configure(std::chrono::milliseconds(ttl_millis), (size_t) max_entries);
+    });
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_mnemonicToSeedAsync(
+        JNIEnv *env,
+        jobject thiz,
+        jstring mnemonic,
+        jstring password,
+        jobject token
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(mnemonic, "Mnemonic")) return nullptr;
+
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &mnemonic, &password, &token]() {
+                // Copy shares the native API and stays valid if the instance is closed meanwhile
+                crypto::CryptoApi api = *getCryptoApi(ctx, thiz);
+                SharedSecret mnemonic_c = sharedSecret(ctx, mnemonic);
+                SharedSecret password_c = sharedSecret(ctx, password);
+                return deriveAsync<core::Buffer>(
+                        ctx, thiz, token,
+                        KdfCache::key('s', {mnemonic_c.get(), password_c.get()}),
+                        [api, mnemonic_c, password_c]() mutable {
+                            return password_c != nullptr
+                                   ? api.mnemonicToSeed(mnemonic_c->str(), password_c->str())
+                                   : api.mnemonicToSeed(mnemonic_c->str());
+                        },
+                        [](JniContextUtils &ctx, core::Buffer &seed) -> jobject {
+                            jbyteArray array = ctx->NewByteArray(seed.size());
+                            ctx->SetByteArrayRegion(array, 0, seed.size(), (jbyte *) seed.data());
+                            return array;
+                        });
+            }
+    );
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_fromMnemonicAsync(
+        JNIEnv *env,
+        jobject thiz,
+        jstring mnemonic,
+        jstring password,
+        jobject token
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(mnemonic, "Mnemonic")) return nullptr;
+
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &mnemonic, &password, &token]() {
+                crypto::CryptoApi api = *getCryptoApi(ctx, thiz);
+                SharedSecret mnemonic_c = sharedSecret(ctx, mnemonic);
+                SharedSecret password_c = sharedSecret(ctx, password);
+                return deriveAsync<crypto::BIP39_t>(
+                        ctx, thiz, token,
+                        KdfCache::key('m', {mnemonic_c.get(), password_c.get()}),
+                        [api, mnemonic_c, password_c]() mutable {
+                            return password_c != nullptr
+                                   ? api.fromMnemonic(mnemonic_c->str(), password_c->str())
+                                   : api.fromMnemonic(mnemonic_c->str());
+                        },
+                        [](JniContextUtils &ctx, crypto::BIP39_t &bip39) -> jobject {
+                            // Classes are resolved with the class loader of CryptoApi on executor threads
+                            jclass BIP39Cls = ctx.findClass("com/simplito/kotlin/privmx_endpoint/model/BIP39");
+                            jclass extKeyCls = ctx.findClass(
+                                    "com/simplito/kotlin/privmx_endpoint/modules/crypto/ExtKey");
+                            jmethodID initBIP39MID = ctx->GetMethodID(
+                                    BIP39Cls,
+                                    "<init>",
+                                    "(Ljava/lang/String;Lcom/simplito/kotlin/privmx_endpoint/modules/crypto/ExtKey;[B)V");
+                            jbyteArray entropy = ctx->NewByteArray(bip39.entropy.size());
+                            ctx->SetByteArrayRegion(entropy, 0, bip39.entropy.size(),
+                                                    (jbyte *) bip39.entropy.data());
+                            return ctx->NewObject(
+                                    BIP39Cls,
+                                    initBIP39MID,
+                                    ctx.secret2jString(bip39.mnemonic),
+                                    initExtKey(ctx, bip39.ext_key, extKeyCls),
+                                    entropy);
+                        });
+            }
+    );
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_CryptoApi_derivePrivateKey2Async(
+        JNIEnv *env,
+        jobject thiz,
+        jstring password,
+        jstring salt,
+        jobject token
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(password, "Password") || ctx.nullCheck(salt, "Salt")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &password, &salt, &token]() {
+                crypto::CryptoApi api = *getCryptoApi(ctx, thiz);
+                SharedSecret password_c = sharedSecret(ctx, password);
+                SharedSecret salt_c = sharedSecret(ctx, salt);
+                return deriveAsync<std::string>(
+                        ctx, thiz, token,
+                        KdfCache::key('p', {password_c.get(), salt_c.get()}),
+                        [api, password_c, salt_c]() mutable {
+                            return api.derivePrivateKey2(password_c->str(), salt_c->str());
+                        },
+                        [](JniContextUtils &ctx, std::string &privateKey_c) -> jobject {
+                            privmx::wrapper::SecretString privateKey(std::move(privateKey_c));
+                            return ctx.secret2jString(privateKey.str());
+                        });
+            }
+    );
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
 }
\ No newline at end of file
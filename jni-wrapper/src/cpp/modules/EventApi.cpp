@@ -92,12 +92,10 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_event_EventApi_emitEvent(
     }
 
     ctx.callVoidEndpointApi([&ctx, &thiz, &context_id, &users, &channel_name, &event_data]() {
-        std::vector<core::UserWithPubKey> users_c = usersToVector(
-                ctx,
-                ctx.jObject2jArray(users));
+        UsersArg users_c(ctx, users);
 
         getEventApi(ctx, thiz)->emitEvent(
-                ctx.jString2string(context_id), users_c,
+                ctx.jString2string(context_id), users_c.get(),
                 ctx.jString2string(channel_name),
                 core::Buffer::from(ctx.jByteArray2String(event_data))
         );
@@ -10,8 +10,10 @@
 //
 
 #include "privmx/endpoint/crypto/ExtKey.hpp"
+#include "ExtKey.h"
 #include "../utils.hpp"
 #include <jni.h>
+#include <stdexcept>
 
 using namespace privmx::endpoint;
 
@@ -36,6 +38,44 @@ jobject initExtKey(JniContextUtils &ctx, privmx::endpoint::crypto::ExtKey &extKe
             ctx.long2jLong((jlong) key));
 }
 
+std::vector<uint32_t> parseDerivationPath(const std::string &path) {
+    std::vector<uint32_t> result;
+    size_t pos = 0;
+    if (path.empty() || path == "m") {
+        return result;
+    }
+    if (path.compare(0, 2, "m/") == 0) {
+        pos = 2;
+    }
+    while (true) {
+        size_t end = path.find('/', pos);
+        std::string level = path.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+        bool hardened = !level.empty() && (level.back() == '\'' || level.back() == 'h' || level.back() == 'H');
+        if (hardened) {
+            level.pop_back();
+        }
+        if (level.empty() || level.size() > 10 || level.find_first_not_of("0123456789") != std::string::npos) {
+            throw std::invalid_argument("Invalid derivation path: " + path);
+        }
+        uint64_t index = std::stoull(level);
+        if (index >= HARDENED_INDEX) {
+            throw std::invalid_argument("Derivation path index out of range: " + path);
+        }
+        result.push_back((uint32_t) index | (hardened ? HARDENED_INDEX : 0));
+        if (end == std::string::npos) {
+            return result;
+        }
+        pos = end + 1;
+    }
+}
+
+crypto::ExtKey deriveChild(crypto::ExtKey &parent, uint32_t index) {
+    if (index & HARDENED_INDEX) {
+        return parent.deriveHardened(index & ~HARDENED_INDEX);
+    }
+    return parent.derive(index);
+}
+
 extern "C"
 JNIEXPORT void JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_deinit(
@@ -71,8 +111,9 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_fromSeed(
     ctx.callResultEndpointApi<jobject>(
             &result,
             [&ctx, &clazz, &seed]() {
+                auto seed_c = ctx.jByteArray2secret(seed);
                 crypto::ExtKey extKey = crypto::ExtKey::fromSeed(
-                        core::Buffer::from(ctx.jByteArray2String(seed)));
+                        core::Buffer::from((const char *) seed_c.data(), seed_c.size()));
                 return initExtKey(ctx, extKey, clazz);
             }
     );
@@ -96,7 +137,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_fromBase58(
     ctx.callResultEndpointApi<jobject>(
             &result,
             [&ctx, &clazz, &base58]() {
-                crypto::ExtKey extKey = crypto::ExtKey::fromBase58(ctx.jString2string(base58));
+                crypto::ExtKey extKey = crypto::ExtKey::fromBase58(ctx.jString2secret(base58).str());
                 return initExtKey(ctx, extKey, clazz);
             }
     );
@@ -176,6 +217,35 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_deriveHardened(
     return result;
 }
 
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_derivePath(
+        JNIEnv *env,
+        jobject thiz,
+        jstring path
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(path, "Path")) return nullptr;
+
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &env, &thiz, &path]() {
+                auto indexes = parseDerivationPath(ctx.jString2string(path));
+                crypto::ExtKey extKey = *getExtKey(ctx, thiz);
+                for (auto index: indexes) {
+                    extKey = deriveChild(extKey, index);
+                }
+                jclass cls = env->GetObjectClass(thiz);
+                return initExtKey(ctx, extKey, cls);
+            }
+    );
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
 extern "C"
 JNIEXPORT jstring JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_getPrivatePartAsBase58(
@@ -188,8 +258,8 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_getPrivatePartAs
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &env, &thiz]() {
-                std::string privatePart = getExtKey(ctx, thiz)->getPrivatePartAsBase58();
-                return ctx->NewStringUTF(privatePart.c_str());
+                privmx::wrapper::SecretString privatePart(getExtKey(ctx, thiz)->getPrivatePartAsBase58());
+                return ctx.secret2jString(privatePart.str());
             }
     );
     if (ctx->ExceptionCheck()) {
@@ -211,7 +281,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_getPublicPartAsB
             &result,
             [&ctx, &env, &thiz]() {
                 std::string publicPart = getExtKey(ctx, thiz)->getPublicPartAsBase58();
-                return ctx->NewStringUTF(publicPart.c_str());
+                return ctx.string2jString(publicPart);
             }
     );
     if (ctx->ExceptionCheck()) {
@@ -232,8 +302,8 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_getPrivateKey(
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &env, &thiz]() {
-                std::string privateKey = getExtKey(ctx, thiz)->getPrivateKey();
-                return ctx->NewStringUTF(privateKey.c_str());
+                privmx::wrapper::SecretString privateKey(getExtKey(ctx, thiz)->getPrivateKey());
+                return ctx.secret2jString(privateKey.str());
             }
     );
     if (ctx->ExceptionCheck()) {
@@ -255,7 +325,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_getPublicKey(
             &result,
             [&ctx, &env, &thiz]() {
                 std::string publicKey = getExtKey(ctx, thiz)->getPublicKey();
-                return ctx->NewStringUTF(publicKey.c_str());
+                return ctx.string2jString(publicKey);
             }
     );
     if (ctx->ExceptionCheck()) {
@@ -303,7 +373,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKey_getPublicKeyAsBa
             &result,
             [&ctx, &env, &thiz]() {
                 std::string publicKey = getExtKey(ctx, thiz)->getPublicKeyAsBase58Address();
-                return ctx->NewStringUTF(publicKey.c_str());
+                return ctx.string2jString(publicKey);
             }
     );
     if (ctx->ExceptionCheck()) {
@@ -0,0 +1,41 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <privmx/endpoint/crypto/ExtKey.hpp>
+#include "../utils.hpp"
+
+#ifndef PRIVMXENDPOINT_EXTKEY_H
+#define PRIVMXENDPOINT_EXTKEY_H
+
+// Set in indexes returned by parseDerivationPath for hardened derivation
+constexpr uint32_t HARDENED_INDEX = 0x80000000u;
+
+privmx::endpoint::crypto::ExtKey *getExtKey(JniContextUtils &ctx, jobject thiz);
+
+jobject initExtKey(JniContextUtils &ctx, privmx::endpoint::crypto::ExtKey &extKey_c, jclass clazz);
+
+/**
+ * Parses BIP32 path such as "m/44'/0'/0/1", where "m" stands for the key the path is applied to.
+ * Hardened levels are marked with ' or h and returned with HARDENED_INDEX set.
+ * Throws std::invalid_argument when the path is malformed.
+ */
+std::vector<uint32_t> parseDerivationPath(const std::string &path);
+
+/**
+ * Derives child of given key at index returned by parseDerivationPath.
+ */
+privmx::endpoint::crypto::ExtKey deriveChild(privmx::endpoint::crypto::ExtKey &parent, uint32_t index);
+
+#endif //PRIVMXENDPOINT_EXTKEY_H
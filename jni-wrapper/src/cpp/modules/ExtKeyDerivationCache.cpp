@@ -0,0 +1,179 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <privmx/endpoint/crypto/ExtKey.hpp>
+#include "ExtKey.h"
+#include "../utils.hpp"
+#include "../exceptions.h"
+
+using namespace privmx::endpoint;
+
+namespace {
+    /**
+     * Keys derived from a single root, least recently used first to be evicted.
+     * Entries are keyed by the raw indexes of their path, so equivalent notations ("1'" and "1h") share them.
+     */
+    class DerivationCache {
+    public:
+        DerivationCache(const crypto::ExtKey &root, size_t capacity) : _root(root), _capacity(capacity) {}
+
+        crypto::ExtKey derive(const std::vector<uint32_t> &indexes) {
+            std::string fullKey(reinterpret_cast<const char *>(indexes.data()), indexes.size() * sizeof(uint32_t));
+            crypto::ExtKey key = _root;
+            size_t depth = 0;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (size_t level = indexes.size(); level > 0; --level) {
+                    auto it = _index.find(fullKey.substr(0, level * sizeof(uint32_t)));
+                    if (it != _index.end()) {
+                        _entries.splice(_entries.begin(), _entries, it->second);
+                        key = it->second->second;
+                        depth = level;
+                        break;
+                    }
+                }
+            }
+            if (depth == indexes.size()) {
+                return key;
+            }
+            // Derivation runs unlocked, so concurrent callers do not wait for each other
+            std::vector<crypto::ExtKey> derived;
+            derived.reserve(indexes.size() - depth);
+            for (size_t level = depth; level < indexes.size(); ++level) {
+                key = deriveChild(key, indexes[level]);
+                derived.push_back(key);
+            }
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < derived.size(); ++i) {
+                put(fullKey.substr(0, (depth + i + 1) * sizeof(uint32_t)), derived[i]);
+            }
+            return key;
+        }
+
+        void clear() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _index.clear();
+            _entries.clear();
+        }
+
+    private:
+        using Entries = std::list<std::pair<std::string, crypto::ExtKey>>;
+
+        void put(const std::string &path, const crypto::ExtKey &key) {
+            auto it = _index.find(path);
+            if (it != _index.end()) {
+                _entries.splice(_entries.begin(), _entries, it->second);
+                return;
+            }
+            _entries.emplace_front(path, key);
+            _index.emplace(path, _entries.begin());
+            if (_entries.size() > _capacity) {
+                _index.erase(_entries.back().first);
+                _entries.pop_back();
+            }
+        }
+
+        crypto::ExtKey _root;
+        size_t _capacity;
+        std::mutex _mutex;
+        Entries _entries;
+        std::unordered_map<std::string, Entries::iterator> _index;
+    };
+
+    DerivationCache *getDerivationCache(JniContextUtils &ctx, jobject thiz) {
+        jclass cls = ctx->GetObjectClass(thiz);
+        jfieldID cacheFID = ctx->GetFieldID(cls, "cache", "Ljava/lang/Long;");
+        jobject cacheLong = ctx->GetObjectField(thiz, cacheFID);
+        if (cacheLong == nullptr) {
+            throw IllegalStateException("This ExtKeyDerivationCache instance cannot be used anymore");
+        }
+        return (DerivationCache *) ctx.getObject(cacheLong).getLongValue();
+    }
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKeyDerivationCache_create(
+        JNIEnv *env,
+        jclass clazz,
+        jobject root,
+        jint capacity
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(root, "Root")) {
+        return 0;
+    }
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &root, capacity]() {
+        if (capacity <= 0) {
+            throw std::invalid_argument("Capacity must be positive");
+        }
+        return (jlong) new DerivationCache(*getExtKey(ctx, root), (size_t) capacity);
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKeyDerivationCache_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    delete (DerivationCache *) ptr;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKeyDerivationCache_derivePath(
+        JNIEnv *env,
+        jobject thiz,
+        jstring path
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(path, "Path")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &path]() {
+        auto cache = getDerivationCache(ctx, thiz);
+        crypto::ExtKey extKey = cache->derive(parseDerivationPath(ctx.jString2string(path)));
+        jclass cls = ctx->FindClass("com/simplito/kotlin/privmx_endpoint/modules/crypto/ExtKey");
+        return initExtKey(ctx, extKey, cls);
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_ExtKeyDerivationCache_clear(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    ctx.callVoidEndpointApi([&ctx, &thiz]() {
+        getDerivationCache(ctx, thiz)->clear();
+    });
+}
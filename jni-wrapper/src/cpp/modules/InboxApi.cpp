@@ -15,7 +15,10 @@
 #include "Connection.h"
 #include "ThreadApi.h"
 #include "StoreApi.h"
+#include "InboxApi.h"
 #include "../utils.hpp"
+#include "../bulk.h"
+#include "../executor.h"
 #include "../parser.h"
 #include "../model_native_initializers.h"
 #include "../exceptions.h"
@@ -109,27 +112,19 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_createInbox(
                 if (files_config != nullptr) {
                     files_config_c = parseFilesConfig(ctx, files_config);
                 }
-                std::vector<core::UserWithPubKey> users_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(users)
-                );
-                std::vector<core::UserWithPubKey> managers_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(managers)
-                );
-                auto container_policies_n = std::optional<core::ContainerPolicyWithoutItem>(
-                        parseContainerPolicyWithoutItem(ctx, container_policies));
-                return ctx->NewStringUTF(
+                UsersArg users_c(ctx, users);
+                UsersArg managers_c(ctx, managers);
+                ContainerPolicyWithoutItemArg container_policies_n(ctx, container_policies);
+                return ctx.string2jString(
                         getInboxApi(ctx, thiz)->createInbox(
                                 ctx.jString2string(context_id),
-                                users_c,
-                                managers_c,
+                                users_c.get(),
+                                managers_c.get(),
                                 core::Buffer::from(ctx.jByteArray2String(public_meta)),
                                 core::Buffer::from(ctx.jByteArray2String(private_meta)),
                                 files_config_c,
-                                container_policies_n
-                        ).c_str()
-                );
+                                container_policies_n.get()
+                        ));
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -137,7 +132,6 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_createInbox(
     return result;
 }
 
-
 extern "C"
 JNIEXPORT void JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_updateInbox(
@@ -180,27 +174,20 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_updateInbox(
                 if (files_config != nullptr) {
                     files_config_c = parseFilesConfig(ctx, files_config);
                 }
-                std::vector<core::UserWithPubKey> users_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(users)
-                );
-                std::vector<core::UserWithPubKey> managers_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(managers)
-                );
-                auto container_policies_n = std::optional<core::ContainerPolicyWithoutItem>(
-                        parseContainerPolicyWithoutItem(ctx, container_policies));
+                UsersArg users_c(ctx, users);
+                UsersArg managers_c(ctx, managers);
+                ContainerPolicyWithoutItemArg container_policies_n(ctx, container_policies);
                 getInboxApi(ctx, thiz)->updateInbox(
                         ctx.jString2string(inbox_id),
-                        users_c,
-                        managers_c,
+                        users_c.get(),
+                        managers_c.get(),
                         core::Buffer::from(ctx.jByteArray2String(public_meta)),
                         core::Buffer::from(ctx.jByteArray2String(private_meta)),
                         files_config_c,
                         version,
                         force == JNI_TRUE,
                         force_generate_new_key == JNI_TRUE,
-                        container_policies_n
+                        container_policies_n.get()
                 );
             });
 }
@@ -233,64 +220,35 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_getInbox(
     return result;
 }
 
-extern "C"
-JNIEXPORT jobject JNICALL
-Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listInboxes(
+static jobject listInboxes(
         JNIEnv *env,
         jobject thiz,
         jstring context_id,
-        jlong skip,
-        jlong limit,
-        jstring sort_order,
-        jstring last_id,
-        jstring query_as_json
+        const PagingQueryArgs &paging
 ) {
     JniContextUtils ctx(env);
     if (ctx.nullCheck(context_id, "Context ID") ||
-        ctx.nullCheck(sort_order, "Sort order")) {
+        paging.nullCheck(ctx)) {
         return nullptr;
     }
     jobject result;
     ctx.callResultEndpointApi<jobject>(
             &result,
-            [&ctx, &thiz, &context_id, &skip, &limit, &sort_order, &last_id, &query_as_json]() {
-                jclass pagingListCls = ctx->FindClass(
-                        "com/simplito/kotlin/privmx_endpoint/model/PagingList");
-                jmethodID pagingListInitMID = ctx->GetMethodID(pagingListCls, "<init>",
-                                                               "(Ljava/lang/Long;Ljava/util/List;)V");
-                jclass arrayCls = ctx->FindClass("java/util/ArrayList");
-                jmethodID initArrayMID = ctx->GetMethodID(arrayCls, "<init>", "()V");
-                jmethodID addToArrayMID = ctx->GetMethodID(arrayCls, "add",
-                                                           "(Ljava/lang/Object;)Z");
-                auto query = core::PagingQuery();
-                query.skip = skip;
-                query.limit = limit;
-                query.sortOrder = ctx.jString2string(sort_order);
-                if (last_id != nullptr) {
-                    query.lastId = ctx.jString2string(last_id);
-                }
-                if (query_as_json != nullptr) {
-                    query.queryAsJson = ctx.jString2string(query_as_json);
-                }
+            [&ctx, &thiz, &context_id, &paging]() {
+                auto query = paging.toPagingQuery(ctx);
                 auto inboxes_c(
                         getInboxApi(ctx, thiz)->listInboxes(
                                 ctx.jString2string(context_id),
                                 query
                         )
                 );
-                jobject array = ctx->NewObject(arrayCls, initArrayMID);
-                for (auto &inbox_c: inboxes_c.readItems) {
-                    ctx->CallBooleanMethod(array,
-                                           addToArrayMID,
-                                           privmx::wrapper::inbox2Java(ctx, inbox_c)
-                    );
-                }
-                return ctx->NewObject(
-                        pagingListCls,
-                        pagingListInitMID,
-                        ctx.long2jLong(inboxes_c.totalAvailable),
-                        array
-                );
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return privmx::wrapper::pagingList2Java(
+                        ctx,
+                        inboxes_c,
+                        [&ctx](auto &inbox_c) {
+                            return privmx::wrapper::inbox2Java(ctx, inbox_c);
+                        });
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -298,6 +256,37 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listInboxes(
     return result;
 }
 
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listInboxes(
+        JNIEnv *env,
+        jobject thiz,
+        jstring context_id,
+        jlong skip,
+        jlong limit,
+        jstring sort_order,
+        jstring last_id,
+        jstring query_as_json
+) {
+    return listInboxes(env, thiz, context_id,
+                       PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json));
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listInboxesPrepared(
+        JNIEnv *env,
+        jobject thiz,
+        jstring context_id,
+        jlong skip,
+        jlong limit,
+        jobject prepared_query,
+        jstring last_id
+) {
+    return listInboxes(env, thiz, context_id,
+                       PagingQueryArgs::prepared(skip, limit, prepared_query, last_id));
+}
+
 extern "C"
 JNIEXPORT jobject JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_getInboxPublicView(
@@ -400,6 +389,29 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_sendEntry(
     });
 }
 
+static jobject readEntry(JNIEnv *env, jobject thiz, jstring inbox_entry_id, jint fields) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(inbox_entry_id, "Inbox Entry ID")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &inbox_entry_id, &fields]() {
+                return privmx::wrapper::inboxEntry2Java(
+                        ctx,
+                        getInboxApi(ctx, thiz)->readEntry(
+                                ctx.jString2string(inbox_entry_id)
+                        ),
+                        fields
+                );
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
 extern "C"
 JNIEXPORT jobject JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_readEntry(
@@ -407,26 +419,119 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_readEntry(
         jobject thiz,
         jstring inbox_entry_id
 ) {
+    return readEntry(env, thiz, inbox_entry_id, privmx::wrapper::projection::ALL);
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_readEntryProjected(
+        JNIEnv *env,
+        jobject thiz,
+        jstring inbox_entry_id,
+        jint fields
+) {
+    return readEntry(env, thiz, inbox_entry_id, fields);
+}
+
+static jobject readEntries(JNIEnv *env, jobject thiz, jobject inbox_entry_ids, jint fields) {
     JniContextUtils ctx(env);
-    if (ctx.nullCheck(inbox_entry_id, "Inbox Entry ID")) {
+    if (ctx.nullCheck(inbox_entry_ids, "Inbox Entry IDs")) {
         return nullptr;
     }
     jobject result;
     ctx.callResultEndpointApi<jobject>(
             &result,
-            [&ctx, &thiz, &inbox_entry_id]() {
-                return privmx::wrapper::inboxEntry2Java(
+            [&ctx, &thiz, &inbox_entry_ids, &fields]() -> jobject {
+                auto api = getInboxApi(ctx, thiz);
+                std::vector<std::string> ids_c;
+                if (!privmx::wrapper::jList2ids(ctx, inbox_entry_ids, ids_c)) {
+                    return nullptr;
+                }
+                std::vector<std::optional<inbox::InboxEntry>> entries_c(ids_c.size());
+                std::vector<std::exception_ptr> errors(ids_c.size());
+                privmx::wrapper::runParallel(
+                        ids_c.size(),
+                        privmx::wrapper::BULK_MAX_THREADS,
+                        [api, &ids_c, &entries_c, &errors](size_t i) {
+                            try {
+                                entries_c[i] = api->readEntry(ids_c[i]);
+                            } catch (...) {
+                                errors[i] = std::current_exception();
+                            }
+                        });
+                for (auto &error: errors) {
+                    if (error) {
+                        std::rethrow_exception(error);
+                    }
+                }
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return ctx.vector2jList(entries_c, [&ctx, &fields](auto &entry_c) {
+                    return privmx::wrapper::inboxEntry2Java(ctx, *entry_c, fields);
+                });
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_readEntries(
+        JNIEnv *env,
+        jobject thiz,
+        jobject inbox_entry_ids
+) {
+    return readEntries(env, thiz, inbox_entry_ids, privmx::wrapper::projection::ALL);
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_readEntriesProjected(
+        JNIEnv *env,
+        jobject thiz,
+        jobject inbox_entry_ids,
+        jint fields
+) {
+    return readEntries(env, thiz, inbox_entry_ids, fields);
+}
+
+static jobject listEntries(
+        JNIEnv *env,
+        jobject thiz,
+        jstring inbox_id,
+        const PagingQueryArgs &paging,
+        jint fields
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(inbox_id, "Inbox ID") ||
+        paging.nullCheck(ctx)) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &inbox_id, &paging, &fields]() {
+                auto query = paging.toPagingQuery(ctx);
+                auto entries_c(
+                        getInboxApi(ctx, thiz)->listEntries(
+                                ctx.jString2string(inbox_id),
+                                query
+                        ));
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return privmx::wrapper::pagingList2Java(
                         ctx,
-                        getInboxApi(ctx, thiz)->readEntry(
-                                ctx.jString2string(inbox_entry_id)
-                        )
-                );
+                        entries_c,
+                        [&ctx, &fields](auto &entry_c) {
+                            return privmx::wrapper::inboxEntry2Java(ctx, entry_c, fields);
+                        });
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
     }
     return result;
 }
+
 extern "C"
 JNIEXPORT jobject JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listEntries(
@@ -438,50 +543,74 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listEntries(
         jstring sort_order,
         jstring last_id,
         jstring query_as_json
+) {
+    return listEntries(env, thiz, inbox_id,
+                       PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json),
+                       privmx::wrapper::projection::ALL);
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listEntriesProjected(
+        JNIEnv *env,
+        jobject thiz,
+        jstring inbox_id,
+        jlong skip,
+        jlong limit,
+        jstring sort_order,
+        jstring last_id,
+        jstring query_as_json,
+        jint fields
+) {
+    return listEntries(env, thiz, inbox_id,
+                       PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json),
+                       fields);
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listEntriesPrepared(
+        JNIEnv *env,
+        jobject thiz,
+        jstring inbox_id,
+        jlong skip,
+        jlong limit,
+        jobject prepared_query,
+        jstring last_id,
+        jint fields
+) {
+    return listEntries(env, thiz, inbox_id,
+                       PagingQueryArgs::prepared(skip, limit, prepared_query, last_id), fields);
+}
+
+static jobject listEntriesLazy(
+        JNIEnv *env,
+        jobject thiz,
+        jstring inbox_id,
+        const PagingQueryArgs &paging
 ) {
     JniContextUtils ctx(env);
     if (ctx.nullCheck(inbox_id, "Inbox ID") ||
-        ctx.nullCheck(sort_order, "Sort order")) {
+        paging.nullCheck(ctx)) {
         return nullptr;
     }
     jobject result;
     ctx.callResultEndpointApi<jobject>(
             &result,
-            [&ctx, &thiz, &inbox_id, &skip, &limit, &sort_order, &last_id, &query_as_json]() {
-                jclass pagingListCls = ctx->FindClass(
-                        "com/simplito/kotlin/privmx_endpoint/model/PagingList");
-                jmethodID pagingListInitMID = ctx->GetMethodID(pagingListCls, "<init>",
-                                                               "(Ljava/lang/Long;Ljava/util/List;)V");
-                jclass arrayCls = ctx->FindClass("java/util/ArrayList");
-                jmethodID initArrayMID = ctx->GetMethodID(arrayCls, "<init>", "()V");
-                jmethodID addToArrayMID = ctx->GetMethodID(arrayCls, "add",
-                                                           "(Ljava/lang/Object;)Z");
-                auto query = core::PagingQuery();
-                query.skip = skip;
-                query.limit = limit;
-                query.sortOrder = ctx.jString2string(sort_order);
-                if (last_id != nullptr) {
-                    query.lastId = ctx.jString2string(last_id);
-                }
-                if (query_as_json != nullptr) {
-                    query.queryAsJson = ctx.jString2string(query_as_json);
-                }
+            [&ctx, &thiz, &inbox_id, &paging]() {
+                auto query = paging.toPagingQuery(ctx);
                 auto entries_c(
                         getInboxApi(ctx, thiz)->listEntries(
                                 ctx.jString2string(inbox_id),
                                 query
                         ));
-                jobject array = ctx->NewObject(arrayCls, initArrayMID);
-                for (auto &entry_c: entries_c.readItems) {
-                    ctx->CallBooleanMethod(array,
-                                           addToArrayMID,
-                                           privmx::wrapper::inboxEntry2Java(ctx, entry_c));
-                }
-                return ctx->NewObject(
-                        pagingListCls,
-                        pagingListInitMID,
-                        ctx.long2jLong(entries_c.totalAvailable),
-                        array);
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return privmx::wrapper::pagingList2Java(
+                        ctx,
+                        entries_c,
+                        [&ctx](auto &entry_c) {
+                            return privmx::wrapper::lazyInboxEntry2Java(ctx, std::move(entry_c));
+                        });
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -489,6 +618,37 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listEntries(
     return result;
 }
 
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listEntriesLazy(
+        JNIEnv *env,
+        jobject thiz,
+        jstring inbox_id,
+        jlong skip,
+        jlong limit,
+        jstring sort_order,
+        jstring last_id,
+        jstring query_as_json
+) {
+    return listEntriesLazy(env, thiz, inbox_id,
+                           PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json));
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_listEntriesLazyPrepared(
+        JNIEnv *env,
+        jobject thiz,
+        jstring inbox_id,
+        jlong skip,
+        jlong limit,
+        jobject prepared_query,
+        jstring last_id
+) {
+    return listEntriesLazy(env, thiz, inbox_id,
+                           PagingQueryArgs::prepared(skip, limit, prepared_query, last_id));
+}
+
 extern "C"
 JNIEXPORT void JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_deleteEntry(
@@ -598,13 +758,13 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_readFromFile(
     ctx.callResultEndpointApi<jbyteArray>(
             &result,
             [&ctx, &thiz, &file_handle, &length]() {
-                auto data_c = getInboxApi(ctx, thiz)->readFromFile(file_handle, length).stdString();
-                jbyteArray data = ctx->NewByteArray(data_c.length());
+                auto data_c = getInboxApi(ctx, thiz)->readFromFile(file_handle, length);
+                jbyteArray data = ctx->NewByteArray(data_c.size());
                 ctx->SetByteArrayRegion(
                         data,
                         0,
-                        data_c.length(),
-                        (jbyte *) data_c.c_str()
+                        data_c.size(),
+                        (jbyte *) data_c.data()
                 );
                 return data;
             });
@@ -614,6 +774,30 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_readFromFile(
     return result;
 }
 
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_readFromFileDirect(
+        JNIEnv *env,
+        jobject thiz,
+        jlong file_handle,
+        jlong length
+) {
+    JniContextUtils ctx(env);
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &file_handle, &length]() {
+                return privmx::wrapper::nativeBuffer2Java(
+                        ctx,
+                        getInboxApi(ctx, thiz)->readFromFile(file_handle, length)
+                );
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
 extern "C"
 JNIEXPORT void JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_seekInFile(
@@ -643,10 +827,9 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_closeFile(
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &thiz, &file_handle]() {
-                return ctx->NewStringUTF(
+                return ctx.string2jString(
                         getInboxApi(ctx, thiz)->closeFile(file_handle)
-                                .c_str()
-                );
+                                );
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -695,6 +878,29 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_subscribeForEnt
         );
     });
 }
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_subscribeForEntryEventsBulk(
+        JNIEnv *env,
+        jobject thiz,
+        jobject inbox_ids
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(inbox_ids, "Inbox IDs")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &inbox_ids]() {
+        auto inboxApi = getInboxApi(ctx, thiz);
+        return privmx::wrapper::forEachIdParallel(ctx, inbox_ids, [inboxApi](const std::string &inboxId) {
+            inboxApi->subscribeForEntryEvents(inboxId);
+        });
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
 
 extern "C"
 JNIEXPORT void JNICALL
@@ -709,4 +915,27 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_unsubscribeFrom
                 ctx.jString2string(inbox_id)
         );
     });
+}
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxApi_unsubscribeFromEntryEventsBulk(
+        JNIEnv *env,
+        jobject thiz,
+        jobject inbox_ids
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(inbox_ids, "Inbox IDs")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &inbox_ids]() {
+        auto inboxApi = getInboxApi(ctx, thiz);
+        return privmx::wrapper::forEachIdParallel(ctx, inbox_ids, [inboxApi](const std::string &inboxId) {
+            inboxApi->unsubscribeFromEntryEvents(inboxId);
+        });
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
 }
\ No newline at end of file
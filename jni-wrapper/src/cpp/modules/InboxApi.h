@@ -0,0 +1,21 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <privmx/endpoint/inbox/InboxApi.hpp>
+#include "../utils.hpp"
+
+#ifndef PRIVMXENDPOINT_INBOXAPI_H
+#define PRIVMXENDPOINT_INBOXAPI_H
+
+#endif //PRIVMXENDPOINT_INBOXAPI_H
+
+privmx::endpoint::inbox::InboxApi *getInboxApi(JniContextUtils &ctx, jobject inboxApiInstance);
\ No newline at end of file
@@ -0,0 +1,237 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <memory>
+#include <optional>
+#include <privmx/endpoint/inbox/InboxApi.hpp>
+#include "InboxApi.h"
+#include "../utils.hpp"
+#include "../model_native_initializers.h"
+#include "../exceptions.h"
+
+using namespace privmx::endpoint;
+
+namespace {
+    /**
+     * Inbox and sender resolved once for all entries sent within the session.
+     */
+    struct IngestionSession {
+        // Copy shares the native API with the InboxApi instance and keeps it alive while the session is used
+        inbox::InboxApi inboxApi;
+        std::string inboxId;
+        std::optional<std::string> userPrivKey;
+        inbox::InboxPublicView publicView;
+    };
+
+    std::shared_ptr<IngestionSession> getSession(JniContextUtils &ctx, jobject thiz) {
+        jclass cls = ctx->GetObjectClass(thiz);
+        jfieldID sessionFID = ctx->GetFieldID(cls, "session", "Ljava/lang/Long;");
+        jobject sessionLong = ctx->GetObjectField(thiz, sessionFID);
+        if (sessionLong == nullptr) {
+            throw IllegalStateException("This InboxIngestionSession instance cannot be used anymore");
+        }
+        return *(std::shared_ptr<IngestionSession> *) ctx.getObject(sessionLong).getLongValue();
+    }
+
+    std::vector<int64_t> fileHandles2Vector(JniContextUtils &ctx, jlongArray fileHandles) {
+        std::vector<int64_t> result(ctx->GetArrayLength(fileHandles));
+        ctx->GetLongArrayRegion(fileHandles, 0, (jsize) result.size(), (jlong *) result.data());
+        return result;
+    }
+
+    int64_t prepareEntry(IngestionSession &session, const core::Buffer &data, const std::vector<int64_t> &fileHandles) {
+        return session.inboxApi.prepareEntry(session.inboxId, data, fileHandles, session.userPrivKey);
+    }
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxIngestionSession_create(
+        JNIEnv *env,
+        jclass clazz,
+        jobject inbox_api,
+        jstring inbox_id,
+        jstring user_priv_key
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(inbox_api, "Inbox API") ||
+        ctx.nullCheck(inbox_id, "Inbox ID")) {
+        return 0;
+    }
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &inbox_api, &inbox_id, &user_priv_key]() {
+        auto session = std::make_shared<IngestionSession>(IngestionSession{
+                *getInboxApi(ctx, inbox_api),
+                ctx.jString2string(inbox_id)
+        });
+        if (user_priv_key != nullptr) {
+            session->userPrivKey = ctx.jString2string(user_priv_key);
+        }
+        // Fails early when the Inbox does not exist or is not accessible
+        session->publicView = session->inboxApi.getInboxPublicView(session->inboxId);
+        return (jlong) new std::shared_ptr<IngestionSession>(std::move(session));
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxIngestionSession_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    delete (std::shared_ptr<IngestionSession> *) ptr;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxIngestionSession_getPublicView(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz]() {
+        return privmx::wrapper::inboxPublicView2Java(ctx, getSession(ctx, thiz)->publicView);
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxIngestionSession_prepareEntry(
+        JNIEnv *env,
+        jobject thiz,
+        jbyteArray data,
+        jlongArray file_handles
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(data, "Data") ||
+        ctx.nullCheck(file_handles, "File handles")) {
+        return 0;
+    }
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &thiz, &data, &file_handles]() {
+        return (jlong) prepareEntry(
+                *getSession(ctx, thiz),
+                core::Buffer::from(ctx.jByteArray2String(data)),
+                fileHandles2Vector(ctx, file_handles)
+        );
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxIngestionSession_sendEntry(
+        JNIEnv *env,
+        jobject thiz,
+        jlong inbox_handle
+) {
+    JniContextUtils ctx(env);
+    ctx.callVoidEndpointApi([&ctx, &thiz, &inbox_handle]() {
+        getSession(ctx, thiz)->inboxApi.sendEntry(inbox_handle);
+    });
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxIngestionSession_send(
+        JNIEnv *env,
+        jobject thiz,
+        jbyteArray data
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(data, "Data")) {
+        return;
+    }
+    ctx.callVoidEndpointApi([&ctx, &thiz, &data]() {
+        auto session = getSession(ctx, thiz);
+        auto inboxHandle = prepareEntry(*session, core::Buffer::from(ctx.jByteArray2String(data)), {});
+        session->inboxApi.sendEntry(inboxHandle);
+    });
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxIngestionSession_sendAsync(
+        JNIEnv *env,
+        jobject thiz,
+        jbyteArray data,
+        jobject token
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(data, "Data")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &data, &token]() {
+        auto session = getSession(ctx, thiz);
+        auto token_c = privmx::wrapper::getCancellationState(ctx, token);
+        auto data_c = core::Buffer::from(ctx.jByteArray2String(data));
+        return ctx.callAsyncEndpointApi(
+                ctx->GetObjectClass(thiz),
+                token_c,
+                [session, data_c]() {
+                    session->inboxApi.sendEntry(prepareEntry(*session, data_c, {}));
+                    return true;
+                },
+                [](JniContextUtils &ctx, bool &) -> jobject {
+                    return ctx.getKotlinUnit();
+                });
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_inbox_InboxIngestionSession_sendEntryAsync(
+        JNIEnv *env,
+        jobject thiz,
+        jlong inbox_handle,
+        jobject token
+) {
+    JniContextUtils ctx(env);
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &inbox_handle, &token]() {
+        auto session = getSession(ctx, thiz);
+        auto token_c = privmx::wrapper::getCancellationState(ctx, token);
+        int64_t inboxHandle_c = inbox_handle;
+        return ctx.callAsyncEndpointApi(
+                ctx->GetObjectClass(thiz),
+                token_c,
+                [session, inboxHandle_c]() {
+                    session->inboxApi.sendEntry(inboxHandle_c);
+                    return true;
+                },
+                [](JniContextUtils &ctx, bool &) -> jobject {
+                    return ctx.getKotlinUnit();
+                });
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
@@ -0,0 +1,388 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <privmx/endpoint/crypto/CryptoApi.hpp>
+#include <privmx/endpoint/crypto/ExtKey.hpp>
+#include "CryptoApi.h"
+#include "ExtKey.h"
+#include "../utils.hpp"
+#include "../exceptions.h"
+#include "../secure.h"
+
+using namespace privmx::endpoint;
+using privmx::wrapper::SecureBuffer;
+using privmx::wrapper::secureZero;
+
+namespace {
+    // Must match KeyPool.Kind on the Kotlin side
+    constexpr int KIND_PRIVATE_KEY = 1;
+    constexpr int KIND_SYMMETRIC_KEY = 2;
+    constexpr int KIND_EXT_KEY = 4;
+
+    // Slot holds one length byte and up to MAX_SECRET_SIZE bytes of the secret
+    constexpr size_t SLOT_SIZE = 64;
+    constexpr size_t MAX_SECRET_SIZE = SLOT_SIZE - 1;
+
+    // Pause after a failed generation, so a persistent error does not spin the worker
+    constexpr auto RETRY_DELAY = std::chrono::seconds(1);
+
+    /**
+     * FIFO of short secrets kept in fixed-size slots of a single SecureBuffer.
+     * Slots are wiped as soon as their secret is taken.
+     */
+    class SecretRing {
+    public:
+        explicit SecretRing(size_t capacity) : _buffer(capacity * SLOT_SIZE), _capacity(capacity) {}
+
+        bool empty() const { return _count == 0; }
+
+        bool full() const { return _count == _capacity; }
+
+        void push(const void *secret, size_t size) {
+            if (size > MAX_SECRET_SIZE) {
+                throw std::runtime_error("Generated key is too long");
+            }
+            unsigned char *slot = _buffer.data() + (_head + _count) % _capacity * SLOT_SIZE;
+            slot[0] = (unsigned char) size;
+            std::memcpy(slot + 1, secret, size);
+            ++_count;
+        }
+
+        /**
+         * Moves the oldest secret to out, which must hold SLOT_SIZE bytes, and returns its size.
+         */
+        size_t pop(unsigned char *out) {
+            unsigned char *slot = _buffer.data() + _head * SLOT_SIZE;
+            size_t size = slot[0];
+            std::memcpy(out, slot + 1, size);
+            secureZero(slot, SLOT_SIZE);
+            _head = (_head + 1) % _capacity;
+            --_count;
+            return size;
+        }
+
+        bool locked() const { return _buffer.locked(); }
+
+    private:
+        SecureBuffer _buffer;
+        size_t _capacity;
+        size_t _head = 0;
+        size_t _count = 0;
+    };
+
+    /**
+     * Generates keys of enabled kinds on a background thread until each queue holds depth keys.
+     * Taking a key from an empty queue generates it on the calling thread instead of waiting.
+     */
+    class KeyPool {
+    public:
+        KeyPool(const crypto::CryptoApi &api, size_t depth, int kinds)
+                : _api(api), _depth(depth), _kinds(kinds), _privateKeys(depth), _symmetricKeys(depth) {
+            _worker = std::thread(&KeyPool::run, this);
+        }
+
+        ~KeyPool() {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopped = true;
+            }
+            _wake.notify_all();
+            _worker.join();
+        }
+
+        KeyPool(const KeyPool &) = delete;
+
+        KeyPool &operator=(const KeyPool &) = delete;
+
+        size_t takePrivateKey(unsigned char *out) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_privateKeys.empty()) {
+                    size_t size = _privateKeys.pop(out);
+                    _wake.notify_all();
+                    return size;
+                }
+            }
+            std::string key = _api.generatePrivateKey(std::nullopt);
+            size_t size = key.size();
+            if (size <= MAX_SECRET_SIZE) {
+                std::memcpy(out, key.data(), size);
+            }
+            secureZero(key.data(), key.size());
+            if (size > MAX_SECRET_SIZE) {
+                throw std::runtime_error("Generated key is too long");
+            }
+            return size;
+        }
+
+        size_t takeKeySymmetric(unsigned char *out) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_symmetricKeys.empty()) {
+                    size_t size = _symmetricKeys.pop(out);
+                    _wake.notify_all();
+                    return size;
+                }
+            }
+            core::Buffer key = _api.generateKeySymmetric();
+            size_t size = key.size();
+            if (size <= MAX_SECRET_SIZE) {
+                std::memcpy(out, key.data(), size);
+            }
+            wipe(key);
+            if (size > MAX_SECRET_SIZE) {
+                throw std::runtime_error("Generated key is too long");
+            }
+            return size;
+        }
+
+        crypto::ExtKey takeExtKey() {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_extKeys.empty()) {
+                    crypto::ExtKey key = _extKeys.front();
+                    _extKeys.pop_front();
+                    _wake.notify_all();
+                    return key;
+                }
+            }
+            return crypto::ExtKey::generateRandom();
+        }
+
+        bool locked() const {
+            return _privateKeys.locked() && _symmetricKeys.locked();
+        }
+
+    private:
+        // First enabled kind whose queue is not full, or 0. Called with _mutex held.
+        int nextKind() const {
+            if ((_kinds & KIND_PRIVATE_KEY) && !_privateKeys.full()) {
+                return KIND_PRIVATE_KEY;
+            }
+            if ((_kinds & KIND_SYMMETRIC_KEY) && !_symmetricKeys.full()) {
+                return KIND_SYMMETRIC_KEY;
+            }
+            if ((_kinds & KIND_EXT_KEY) && _extKeys.size() < _depth) {
+                return KIND_EXT_KEY;
+            }
+            return 0;
+        }
+
+        void run() {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (true) {
+                int kind = 0;
+                _wake.wait(lock, [this, &kind]() { return _stopped || (kind = nextKind()) != 0; });
+                if (_stopped) {
+                    return;
+                }
+                lock.unlock();
+                try {
+                    generate(kind, lock);
+                } catch (...) {
+                    if (!lock.owns_lock()) {
+                        lock.lock();
+                    }
+                    _wake.wait_for(lock, RETRY_DELAY, [this]() { return _stopped; });
+                }
+            }
+        }
+
+        // Buffers returned by the core library are not meant to be modified, but the key must not stay on the heap
+        static void wipe(core::Buffer &key) {
+            secureZero(const_cast<char *>(key.data()), key.size());
+        }
+
+        // Generates one key of given kind unlocked, then stores it with lock reacquired.
+        void generate(int kind, std::unique_lock<std::mutex> &lock) {
+            if (kind == KIND_PRIVATE_KEY) {
+                std::string key = _api.generatePrivateKey(std::nullopt);
+                lock.lock();
+                try {
+                    if (!_privateKeys.full()) {
+                        _privateKeys.push(key.data(), key.size());
+                    }
+                } catch (...) {
+                    secureZero(key.data(), key.size());
+                    throw;
+                }
+                secureZero(key.data(), key.size());
+            } else if (kind == KIND_SYMMETRIC_KEY) {
+                core::Buffer key = _api.generateKeySymmetric();
+                lock.lock();
+                try {
+                    if (!_symmetricKeys.full()) {
+                        _symmetricKeys.push(key.data(), key.size());
+                    }
+                } catch (...) {
+                    wipe(key);
+                    throw;
+                }
+                wipe(key);
+            } else {
+                crypto::ExtKey key = crypto::ExtKey::generateRandom();
+                lock.lock();
+                if (_extKeys.size() < _depth) {
+                    _extKeys.push_back(key);
+                }
+            }
+        }
+
+        // Copy shares the native API with the CryptoApi instance
+        crypto::CryptoApi _api;
+        size_t _depth;
+        int _kinds;
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        bool _stopped = false;
+        SecretRing _privateKeys;
+        SecretRing _symmetricKeys;
+        // Kept by the core library in its own memory, which cannot be locked from here
+        std::deque<crypto::ExtKey> _extKeys;
+        std::thread _worker;
+    };
+
+    KeyPool *getKeyPool(JniContextUtils &ctx, jobject thiz) {
+        jclass cls = ctx->GetObjectClass(thiz);
+        jfieldID poolFID = ctx->GetFieldID(cls, "pool", "Ljava/lang/Long;");
+        jobject poolLong = ctx->GetObjectField(thiz, poolFID);
+        if (poolLong == nullptr) {
+            throw IllegalStateException("This KeyPool instance cannot be used anymore");
+        }
+        return (KeyPool *) ctx.getObject(poolLong).getLongValue();
+    }
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_KeyPool_create(
+        JNIEnv *env,
+        jclass clazz,
+        jobject crypto_api,
+        jint depth,
+        jint kinds
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(crypto_api, "Crypto API")) {
+        return 0;
+    }
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &crypto_api, depth, kinds]() {
+        if (depth <= 0) {
+            throw std::invalid_argument("Depth must be positive");
+        }
+        return (jlong) new KeyPool(*getCryptoApi(ctx, crypto_api), (size_t) depth, kinds);
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_KeyPool_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    delete (KeyPool *) ptr;
+}
+
+extern "C"
+JNIEXPORT jstring JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_KeyPool_takePrivateKey(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    jstring result;
+    ctx.callResultEndpointApi<jstring>(&result, [&ctx, &thiz]() {
+        unsigned char key[SLOT_SIZE + 1];
+        size_t size = getKeyPool(ctx, thiz)->takePrivateKey(key);
+        // WIF is plain ASCII, so it is passed to Java without an intermediate std::string
+        key[size] = '\0';
+        jstring privateKey = ctx->NewStringUTF((const char *) key);
+        secureZero(key, sizeof(key));
+        return privateKey;
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jbyteArray JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_KeyPool_takeKeySymmetric(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    jbyteArray result;
+    ctx.callResultEndpointApi<jbyteArray>(&result, [&ctx, &thiz]() {
+        unsigned char key[SLOT_SIZE];
+        size_t size = getKeyPool(ctx, thiz)->takeKeySymmetric(key);
+        jbyteArray array = ctx->NewByteArray((jsize) size);
+        ctx->SetByteArrayRegion(array, 0, (jsize) size, (jbyte *) key);
+        secureZero(key, sizeof(key));
+        return array;
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_KeyPool_takeExtKey(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz]() {
+        crypto::ExtKey extKey = getKeyPool(ctx, thiz)->takeExtKey();
+        jclass cls = ctx->FindClass("com/simplito/kotlin/privmx_endpoint/modules/crypto/ExtKey");
+        return initExtKey(ctx, extKey, cls);
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jboolean JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_KeyPool_isLocked(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    jboolean result = JNI_FALSE;
+    ctx.callResultEndpointApi<jboolean>(&result, [&ctx, &thiz]() {
+        return getKeyPool(ctx, thiz)->locked() ? JNI_TRUE : JNI_FALSE;
+    });
+    if (ctx->ExceptionCheck()) {
+        return JNI_FALSE;
+    }
+    return result;
+}
@@ -0,0 +1,100 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <memory>
+#include <privmx/endpoint/core/Buffer.hpp>
+#include "../utils.hpp"
+#include "../exceptions.h"
+
+using namespace privmx::endpoint;
+
+// NativeBuffer and each of its direct views own a reference to the buffer
+using SharedBuffer = std::shared_ptr<core::Buffer>;
+
+SharedBuffer *getNativeBuffer(JniContextUtils &ctx, jobject thiz) {
+    jclass cls = ctx->GetObjectClass(thiz);
+    jfieldID bufferFID = ctx->GetFieldID(cls, "buffer", "Ljava/lang/Long;");
+    jobject bufferLong = ctx->GetObjectField(thiz, bufferFID);
+    if (bufferLong == nullptr) {
+        throw IllegalStateException("This NativeBuffer instance cannot be used anymore");
+    }
+    return (SharedBuffer *) ctx.getObject(bufferLong).getLongValue();
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_NativeBuffer_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    delete (SharedBuffer *) ptr;
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_NativeBuffer_getSize(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &thiz]() {
+        return (jlong) (*getNativeBuffer(ctx, thiz))->size();
+    });
+    return result;
+}
+
+extern "C"
+JNIEXPORT jbyteArray JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_NativeBuffer_copyToByteArray(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    jbyteArray result;
+    ctx.callResultEndpointApi<jbyteArray>(&result, [&ctx, &thiz]() {
+        auto &buffer = *getNativeBuffer(ctx, thiz);
+        jbyteArray array = ctx->NewByteArray(buffer->size());
+        ctx->SetByteArrayRegion(array, 0, buffer->size(), (jbyte *) buffer->data());
+        return array;
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_NativeBuffer_retain(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &thiz]() {
+        return (jlong) new SharedBuffer(*getNativeBuffer(ctx, thiz));
+    });
+    return result;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_NativeBuffer_directView(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ref
+) {
+    auto &buffer = *(SharedBuffer *) ref;
+    return env->NewDirectByteBuffer((void *) buffer->data(), (jlong) buffer->size());
+}
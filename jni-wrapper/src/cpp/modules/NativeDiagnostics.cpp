@@ -0,0 +1,44 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include "../utils.hpp"
+#include "../arena.h"
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_NativeDiagnostics_getArenaStats(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    auto stats = privmx::wrapper::CallArena::stats();
+    jclass arenaStatsCls = ctx->FindClass(
+            "com/simplito/kotlin/privmx_endpoint/model/ArenaStats");
+    jmethodID initArenaStatsMID = ctx->GetMethodID(arenaStatsCls, "<init>", "(JJJJ)V");
+    return ctx->NewObject(
+            arenaStatsCls,
+            initArenaStatsMID,
+            (jlong) stats.allocations,
+            (jlong) stats.allocatedBytes,
+            (jlong) stats.blockAllocations,
+            (jlong) stats.unscopedAllocations
+    );
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_NativeDiagnostics_resetArenaStats(
+        JNIEnv *env,
+        jobject thiz
+) {
+    privmx::wrapper::CallArena::resetStats();
+}
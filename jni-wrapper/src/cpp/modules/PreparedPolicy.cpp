@@ -0,0 +1,81 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include "../utils.hpp"
+#include "../parser.h"
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_PreparedContainerPolicy_create(
+        JNIEnv *env,
+        jclass clazz,
+        jobject policy
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(policy, "Policy")) {
+        return 0;
+    }
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &policy]() {
+        auto prepared = new PreparedPolicy();
+        prepared->policy = parseContainerPolicy(ctx, policy);
+        prepared->policyWithoutItem = parseContainerPolicyWithoutItem(ctx, policy);
+        return (jlong) prepared;
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_PreparedContainerPolicyWithoutItem_create(
+        JNIEnv *env,
+        jclass clazz,
+        jobject policy
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(policy, "Policy")) {
+        return 0;
+    }
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &policy]() {
+        auto prepared = new PreparedPolicy();
+        prepared->policyWithoutItem = parseContainerPolicyWithoutItem(ctx, policy);
+        return (jlong) prepared;
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_PreparedContainerPolicy_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    delete (PreparedPolicy *) ptr;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_PreparedContainerPolicyWithoutItem_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    delete (PreparedPolicy *) ptr;
+}
@@ -0,0 +1,59 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <memory>
+#include <stdexcept>
+#include <Poco/JSON/Parser.h>
+#include "../utils.hpp"
+#include "../parser.h"
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_PreparedQuery_create(
+        JNIEnv *env,
+        jclass clazz,
+        jstring sort_order,
+        jstring query_as_json
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(sort_order, "Sort order")) {
+        return 0;
+    }
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &sort_order, &query_as_json]() {
+        auto prepared = std::make_unique<PreparedQuery>();
+        prepared->sortOrder = ctx.jString2string(sort_order);
+        if (query_as_json != nullptr) {
+            prepared->queryAsJson = ctx.jString2string(query_as_json);
+            // Fail on malformed filter here instead of on every list call
+            auto query = Poco::JSON::Parser().parse(prepared->queryAsJson.value());
+            if (query.type() != typeid(Poco::JSON::Object::Ptr)) {
+                throw std::invalid_argument("Query must be a JSON object");
+            }
+        }
+        return (jlong) prepared.release();
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_PreparedQuery_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    delete (PreparedQuery *) ptr;
+}
@@ -0,0 +1,237 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <openssl/evp.h>
+#include <privmx/endpoint/core/Buffer.hpp>
+#include <privmx/endpoint/crypto/CryptoApi.hpp>
+#include "CryptoApi.h"
+#include "../utils.hpp"
+#include "../exceptions.h"
+
+using namespace privmx::endpoint;
+
+namespace {
+    // Prefixed to the digest before signing, so a stream signature is never a valid signData
+    // signature of a bare 32-byte digest. Includes the terminating zero.
+    constexpr char CONTEXT_TAG[] = "privmx-endpoint/signature-stream/v1";
+
+    /**
+     * Computes SHA-256 digest of streamed data, then signs or verifies CONTEXT_TAG || digest with CryptoApi.
+     */
+    class SignatureStream {
+    public:
+        explicit SignatureStream(const crypto::CryptoApi &api) : _api(api) {
+            _ctx = EVP_MD_CTX_new();
+            if (_ctx == nullptr || EVP_DigestInit_ex(_ctx, EVP_sha256(), nullptr) != 1) {
+                EVP_MD_CTX_free(_ctx);
+                throw std::runtime_error("Cannot initialize digest");
+            }
+        }
+
+        ~SignatureStream() {
+            EVP_MD_CTX_free(_ctx);
+        }
+
+        SignatureStream(const SignatureStream &) = delete;
+
+        SignatureStream &operator=(const SignatureStream &) = delete;
+
+        void update(const unsigned char *input, size_t len) {
+            checkNotFinished();
+            if (len > 0 && EVP_DigestUpdate(_ctx, input, len) != 1) {
+                throw std::runtime_error("Cannot process data");
+            }
+        }
+
+        core::Buffer sign(const std::string &privateKey) {
+            return _api.signData(taggedDigest(), privateKey);
+        }
+
+        bool verify(const core::Buffer &signature, const std::string &publicKey) {
+            return _api.verifySignature(taggedDigest(), signature, publicKey);
+        }
+
+    private:
+        void checkNotFinished() const {
+            if (_finished) {
+                throw IllegalStateException("This SignatureStream is already finished");
+            }
+        }
+
+        core::Buffer taggedDigest() {
+            checkNotFinished();
+            unsigned char message[sizeof(CONTEXT_TAG) + EVP_MAX_MD_SIZE];
+            std::memcpy(message, CONTEXT_TAG, sizeof(CONTEXT_TAG));
+            unsigned int digestSize = 0;
+            if (EVP_DigestFinal_ex(_ctx, message + sizeof(CONTEXT_TAG), &digestSize) != 1) {
+                throw std::runtime_error("Cannot compute digest");
+            }
+            _finished = true;
+            return core::Buffer::from((const char *) message, sizeof(CONTEXT_TAG) + digestSize);
+        }
+
+        // Copy shares the native API with the CryptoApi instance
+        crypto::CryptoApi _api;
+        EVP_MD_CTX *_ctx;
+        bool _finished = false;
+    };
+
+    SignatureStream *getSignatureStream(JniContextUtils &ctx, jobject thiz) {
+        jclass cls = ctx->GetObjectClass(thiz);
+        jfieldID streamFID = ctx->GetFieldID(cls, "stream", "Ljava/lang/Long;");
+        jobject streamLong = ctx->GetObjectField(thiz, streamFID);
+        if (streamLong == nullptr) {
+            throw IllegalStateException("This SignatureStream instance cannot be used anymore");
+        }
+        return (SignatureStream *) ctx.getObject(streamLong).getLongValue();
+    }
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SignatureStream_create(
+        JNIEnv *env,
+        jclass clazz,
+        jobject crypto_api
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(crypto_api, "Crypto API")) {
+        return 0;
+    }
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &crypto_api]() {
+        return (jlong) new SignatureStream(*getCryptoApi(ctx, crypto_api));
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SignatureStream_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    delete (SignatureStream *) ptr;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SignatureStream_update(
+        JNIEnv *env,
+        jobject thiz,
+        jbyteArray chunk
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(chunk, "Chunk")) {
+        return;
+    }
+    ctx.callVoidEndpointApi([&ctx, &thiz, &chunk]() {
+        auto stream = getSignatureStream(ctx, thiz);
+        jsize size = ctx->GetArrayLength(chunk);
+        // Input is read in place; no JNI calls are made until it is released
+        auto input = (unsigned char *) ctx->GetPrimitiveArrayCritical(chunk, nullptr);
+        if (input == nullptr) {
+            throw std::runtime_error("Cannot access chunk");
+        }
+        try {
+            stream->update(input, size);
+        } catch (...) {
+            ctx->ReleasePrimitiveArrayCritical(chunk, input, JNI_ABORT);
+            throw;
+        }
+        ctx->ReleasePrimitiveArrayCritical(chunk, input, JNI_ABORT);
+    });
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SignatureStream_updateDirect(
+        JNIEnv *env,
+        jobject thiz,
+        jobject input,
+        jint offset,
+        jint length
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(input, "Input")) {
+        return;
+    }
+    ctx.callVoidEndpointApi([&ctx, &thiz, &input, offset, length]() {
+        auto stream = getSignatureStream(ctx, thiz);
+        auto address = (unsigned char *) ctx->GetDirectBufferAddress(input);
+        if (address == nullptr) {
+            throw std::invalid_argument("Buffer must be a direct ByteBuffer");
+        }
+        if (offset < 0 || length < 0 || offset + (jlong) length > ctx->GetDirectBufferCapacity(input)) {
+            throw std::invalid_argument("Buffer range is out of bounds");
+        }
+        stream->update(address + offset, length);
+    });
+}
+
+extern "C"
+JNIEXPORT jbyteArray JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SignatureStream_sign(
+        JNIEnv *env,
+        jobject thiz,
+        jstring private_key
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(private_key, "Private key")) {
+        return nullptr;
+    }
+    jbyteArray result;
+    ctx.callResultEndpointApi<jbyteArray>(&result, [&ctx, &thiz, &private_key]() {
+        auto response = getSignatureStream(ctx, thiz)->sign(ctx.jString2string(private_key));
+        jbyteArray array = ctx->NewByteArray(response.size());
+        ctx->SetByteArrayRegion(array, 0, response.size(), (jbyte *) response.data());
+        return array;
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jboolean JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SignatureStream_verify(
+        JNIEnv *env,
+        jobject thiz,
+        jbyteArray signature,
+        jstring public_key
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(signature, "Signature") ||
+        ctx.nullCheck(public_key, "Public key")) {
+        return JNI_FALSE;
+    }
+    jboolean result;
+    ctx.callResultEndpointApi<jboolean>(&result, [&ctx, &thiz, &signature, &public_key]() {
+        auto response = getSignatureStream(ctx, thiz)->verify(
+                core::Buffer::from(ctx.jByteArray2String(signature)),
+                ctx.jString2string(public_key)
+        );
+        return response ? JNI_TRUE : JNI_FALSE;
+    });
+    if (ctx->ExceptionCheck()) {
+        return JNI_FALSE;
+    }
+    return result;
+}
@@ -15,6 +15,7 @@
 #include "Connection.h"
 #include "StoreApi.h"
 #include "../utils.hpp"
+#include "../bulk.h"
 #include "../parser.h"
 #include "../exceptions.h"
 
@@ -76,65 +77,35 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_deinit(
     }
 }
 
-extern "C"
-JNIEXPORT jobject JNICALL
-Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_listStores(
+static jobject listStores(
         JNIEnv *env,
         jobject thiz,
         jstring context_id,
-        jlong skip,
-        jlong limit,
-        jstring sort_order,
-        jstring last_id,
-        jstring query_as_json
+        const PagingQueryArgs &paging
 ) {
     JniContextUtils ctx(env);
-    if (ctx.nullCheck(sort_order, "Sort order") ||
+    if (paging.nullCheck(ctx) ||
         ctx.nullCheck(context_id, "Context ID")) {
         return nullptr;
     }
     jobject result;
     ctx.callResultEndpointApi<jobject>(
             &result,
-            [&ctx, &thiz, &context_id, &skip, &limit, &sort_order, &last_id, &query_as_json]() {
-                jclass pagingListCls = ctx->FindClass(
-                        "com/simplito/kotlin/privmx_endpoint/model/PagingList");
-                jmethodID pagingListInitMID = ctx->GetMethodID(pagingListCls, "<init>",
-                                                               "(Ljava/lang/Long;Ljava/util/List;)V"
-                );
-                jclass arrayCls = ctx->FindClass("java/util/ArrayList");
-                jmethodID initArrayMID = ctx->GetMethodID(arrayCls, "<init>", "()V");
-                jmethodID addToArrayMID = ctx->GetMethodID(arrayCls, "add",
-                                                           "(Ljava/lang/Object;)Z");
-                auto query = core::PagingQuery();
-                query.skip = skip;
-                query.limit = limit;
-                query.sortOrder = ctx.jString2string(sort_order);
-                if (last_id != nullptr) {
-                    query.lastId = ctx.jString2string(last_id);
-                }
-                if (query_as_json != nullptr) {
-                    query.queryAsJson = ctx.jString2string(query_as_json);
-                }
+            [&ctx, &thiz, &context_id, &paging]() {
+                auto query = paging.toPagingQuery(ctx);
                 auto stores_c(
                         getStoreApi(ctx, thiz)->listStores(
                                 ctx.jString2string(context_id),
                                 query
                         )
                 );
-                jobject array = ctx->NewObject(arrayCls, initArrayMID);
-                for (auto &store_c: stores_c.readItems) {
-                    ctx->CallBooleanMethod(array,
-                                           addToArrayMID,
-                                           privmx::wrapper::store2Java(ctx, store_c)
-                    );
-                }
-                return ctx->NewObject(
-                        pagingListCls,
-                        pagingListInitMID,
-                        ctx.long2jLong(stores_c.totalAvailable),
-                        array
-                );
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return privmx::wrapper::pagingList2Java(
+                        ctx,
+                        stores_c,
+                        [&ctx](auto &store_c) {
+                            return privmx::wrapper::store2Java(ctx, store_c);
+                        });
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -142,6 +113,37 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_listStores(
     return result;
 }
 
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_listStores(
+        JNIEnv *env,
+        jobject thiz,
+        jstring context_id,
+        jlong skip,
+        jlong limit,
+        jstring sort_order,
+        jstring last_id,
+        jstring query_as_json
+) {
+    return listStores(env, thiz, context_id,
+                      PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json));
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_listStoresPrepared(
+        JNIEnv *env,
+        jobject thiz,
+        jstring context_id,
+        jlong skip,
+        jlong limit,
+        jobject prepared_query,
+        jstring last_id
+) {
+    return listStores(env, thiz, context_id,
+                      PagingQueryArgs::prepared(skip, limit, prepared_query, last_id));
+}
+
 extern "C"
 JNIEXPORT jobject JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_getStore(
@@ -170,7 +172,6 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_getStore(
     return result;
 }
 
-
 extern "C"
 JNIEXPORT jstring JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_createStore(
@@ -195,23 +196,18 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_createStore(
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &thiz, &context_id, &users, &managers, &public_meta, &private_meta, &container_policies]() {
-                std::vector<core::UserWithPubKey> managers_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(managers));
-                std::vector<core::UserWithPubKey> users_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(users));
-                auto container_policies_n = std::optional<core::ContainerPolicy>(
-                        parseContainerPolicy(ctx, container_policies));
-                return ctx->NewStringUTF(
+                UsersArg managers_c(ctx, managers);
+                UsersArg users_c(ctx, users);
+                ContainerPolicyArg container_policies_n(ctx, container_policies);
+                return ctx.string2jString(
                         getStoreApi(ctx, thiz)->createStore(
                                 ctx.jString2string(context_id),
-                                users_c,
-                                managers_c,
+                                users_c.get(),
+                                managers_c.get(),
                                 core::Buffer::from(ctx.jByteArray2String(public_meta)),
                                 core::Buffer::from(ctx.jByteArray2String(private_meta)),
-                                container_policies_n
-                        ).c_str());
+                                container_policies_n.get()
+                        ));
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -247,6 +243,41 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_getFile(
     return result;
 }
 
+static jobject listFiles(
+        JNIEnv *env,
+        jobject thiz,
+        jstring store_id,
+        const PagingQueryArgs &paging
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(store_id, "Store ID") ||
+        paging.nullCheck(ctx)) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &store_id, &paging]() {
+                auto query = paging.toPagingQuery(ctx);
+                auto files_c(
+                        getStoreApi(ctx, thiz)->listFiles(
+                                ctx.jString2string(store_id),
+                                query
+                        ));
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return privmx::wrapper::pagingList2Java(
+                        ctx,
+                        files_c,
+                        [&ctx](auto &file_c) {
+                            return privmx::wrapper::file2Java(ctx, file_c);
+                        });
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
 extern "C"
 JNIEXPORT jobject JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_listFiles(
@@ -258,50 +289,54 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_listFiles(
         jstring sort_order,
         jstring last_id,
         jstring query_as_json
+) {
+    return listFiles(env, thiz, store_id,
+                     PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json));
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_listFilesPrepared(
+        JNIEnv *env,
+        jobject thiz,
+        jstring store_id,
+        jlong skip,
+        jlong limit,
+        jobject prepared_query,
+        jstring last_id
+) {
+    return listFiles(env, thiz, store_id,
+                     PagingQueryArgs::prepared(skip, limit, prepared_query, last_id));
+}
+
+static jobject listFilesLazy(
+        JNIEnv *env,
+        jobject thiz,
+        jstring store_id,
+        const PagingQueryArgs &paging
 ) {
     JniContextUtils ctx(env);
     if (ctx.nullCheck(store_id, "Store ID") ||
-        ctx.nullCheck(sort_order, "Sort order")) {
+        paging.nullCheck(ctx)) {
         return nullptr;
     }
     jobject result;
     ctx.callResultEndpointApi<jobject>(
             &result,
-            [&ctx, &thiz, &store_id, &skip, &limit, &sort_order, &last_id, &query_as_json]() {
-                jclass pagingListCls = ctx->FindClass(
-                        "com/simplito/kotlin/privmx_endpoint/model/PagingList");
-                jmethodID pagingListInitMID = ctx->GetMethodID(pagingListCls, "<init>",
-                                                               "(Ljava/lang/Long;Ljava/util/List;)V");
-                jclass arrayCls = ctx->FindClass("java/util/ArrayList");
-                jmethodID initArrayMID = ctx->GetMethodID(arrayCls, "<init>", "()V");
-                jmethodID addToArrayMID = ctx->GetMethodID(arrayCls, "add",
-                                                           "(Ljava/lang/Object;)Z");
-                auto query = core::PagingQuery();
-                query.skip = skip;
-                query.limit = limit;
-                query.sortOrder = ctx.jString2string(sort_order);
-                if (last_id != nullptr) {
-                    query.lastId = ctx.jString2string(last_id);
-                }
-                if (query_as_json != nullptr) {
-                    query.queryAsJson = ctx.jString2string(query_as_json);
-                }
+            [&ctx, &thiz, &store_id, &paging]() {
+                auto query = paging.toPagingQuery(ctx);
                 auto files_c(
                         getStoreApi(ctx, thiz)->listFiles(
                                 ctx.jString2string(store_id),
                                 query
                         ));
-                jobject array = ctx->NewObject(arrayCls, initArrayMID);
-                for (auto &file_c: files_c.readItems) {
-                    ctx->CallBooleanMethod(array,
-                                           addToArrayMID,
-                                           privmx::wrapper::file2Java(ctx, file_c));
-                }
-                return ctx->NewObject(
-                        pagingListCls,
-                        pagingListInitMID,
-                        ctx.long2jLong(files_c.totalAvailable),
-                        array);
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return privmx::wrapper::pagingList2Java(
+                        ctx,
+                        files_c,
+                        [&ctx](auto &file_c) {
+                            return privmx::wrapper::lazyFile2Java(ctx, std::move(file_c));
+                        });
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -309,6 +344,37 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_listFiles(
     return result;
 }
 
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_listFilesLazy(
+        JNIEnv *env,
+        jobject thiz,
+        jstring store_id,
+        jlong skip,
+        jlong limit,
+        jstring sort_order,
+        jstring last_id,
+        jstring query_as_json
+) {
+    return listFilesLazy(env, thiz, store_id,
+                         PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json));
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_listFilesLazyPrepared(
+        JNIEnv *env,
+        jobject thiz,
+        jstring store_id,
+        jlong skip,
+        jlong limit,
+        jobject prepared_query,
+        jstring last_id
+) {
+    return listFilesLazy(env, thiz, store_id,
+                         PagingQueryArgs::prepared(skip, limit, prepared_query, last_id));
+}
+
 extern "C"
 JNIEXPORT void JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_deleteFile(
@@ -493,24 +559,19 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_updateStore(
                     &force,
                     &force_generate_new_key,
                     &container_policies]() {
-                std::vector<core::UserWithPubKey> users_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(users));
-                std::vector<core::UserWithPubKey> managers_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(managers));
-                auto container_policies_n = std::optional<core::ContainerPolicy>(
-                        parseContainerPolicy(ctx, container_policies));
+                UsersArg users_c(ctx, users);
+                UsersArg managers_c(ctx, managers);
+                ContainerPolicyArg container_policies_n(ctx, container_policies);
                 getStoreApi(ctx, thiz)->updateStore(
                         ctx.jString2string(store_id),
-                        users_c,
-                        managers_c,
+                        users_c.get(),
+                        managers_c.get(),
                         core::Buffer::from(ctx.jByteArray2String(public_meta)),
                         core::Buffer::from(ctx.jByteArray2String(private_meta)),
                         version,
                         force == JNI_TRUE,
                         force_generate_new_key == JNI_TRUE,
-                        container_policies_n);
+                        container_policies_n.get());
             });
 }
 
@@ -550,13 +611,13 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_readFromFile(
     JniContextUtils ctx(env);
     jbyteArray result;
     ctx.callResultEndpointApi<jbyteArray>(&result, [&ctx, &thiz, &file_handle, &length]() {
-        auto data_c = getStoreApi(ctx, thiz)->readFromFile(file_handle, length).stdString();
-        jbyteArray data = ctx->NewByteArray(data_c.length());
+        auto data_c = getStoreApi(ctx, thiz)->readFromFile(file_handle, length);
+        jbyteArray data = ctx->NewByteArray(data_c.size());
         ctx->SetByteArrayRegion(
                 data,
                 0,
-                data_c.length(),
-                (jbyte *) data_c.c_str()
+                data_c.size(),
+                (jbyte *) data_c.data()
         );
         return data;
     });
@@ -566,6 +627,70 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_readFromFile(
     return result;
 }
 
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_readFromFileAsync(
+        JNIEnv *env,
+        jobject thiz,
+        jlong file_handle,
+        jlong length,
+        jobject token
+) {
+    JniContextUtils ctx(env);
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &file_handle, &length, &token]() {
+        // Copy shares the native API and stays valid if the instance is closed meanwhile
+        store::StoreApi api = *getStoreApi(ctx, thiz);
+        auto token_c = privmx::wrapper::getCancellationState(ctx, token);
+        int64_t fileHandle_c = file_handle;
+        int64_t length_c = length;
+        return ctx.callAsyncEndpointApi(
+                ctx->GetObjectClass(thiz),
+                token_c,
+                [api, fileHandle_c, length_c]() mutable {
+                    return api.readFromFile(fileHandle_c, length_c);
+                },
+                [](JniContextUtils &ctx, core::Buffer &data_c) -> jobject {
+                    jbyteArray data = ctx->NewByteArray(data_c.size());
+                    ctx->SetByteArrayRegion(
+                            data,
+                            0,
+                            data_c.size(),
+                            (jbyte *) data_c.data()
+                    );
+                    return data;
+                });
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_readFromFileDirect(
+        JNIEnv *env,
+        jobject thiz,
+        jlong file_handle,
+        jlong length
+) {
+    JniContextUtils ctx(env);
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &file_handle, &length]() {
+                return privmx::wrapper::nativeBuffer2Java(
+                        ctx,
+                        getStoreApi(ctx, thiz)->readFromFile(file_handle, length)
+                );
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
 extern "C"
 JNIEXPORT void JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_seekInFile(
@@ -593,10 +718,9 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_closeFile(
     JniContextUtils ctx(env);
     jstring result;
     ctx.callResultEndpointApi<jstring>(&result, [&ctx, &thiz, &file_handle]() {
-        return ctx->NewStringUTF(
+        return ctx.string2jString(
                 getStoreApi(ctx, thiz)->closeFile(file_handle)
-                        .c_str()
-        );
+                        );
     });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -644,6 +768,29 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_subscribeForFil
     });
 }
 extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_subscribeForFileEventsBulk(
+        JNIEnv *env,
+        jobject thiz,
+        jobject store_ids
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(store_ids, "Store IDs")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &store_ids]() {
+        auto storeApi = getStoreApi(ctx, thiz);
+        return privmx::wrapper::forEachIdParallel(ctx, store_ids, [storeApi](const std::string &storeId) {
+            storeApi->subscribeForFileEvents(storeId);
+        });
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+extern "C"
 JNIEXPORT void JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_unsubscribeFromFileEvents(
         JNIEnv *env,
@@ -659,4 +806,27 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_unsubscribeFrom
                 ctx.jString2string(store_id)
         );
     });
+}
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_store_StoreApi_unsubscribeFromFileEventsBulk(
+        JNIEnv *env,
+        jobject thiz,
+        jobject store_ids
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(store_ids, "Store IDs")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &store_ids]() {
+        auto storeApi = getStoreApi(ctx, thiz);
+        return privmx::wrapper::forEachIdParallel(ctx, store_ids, [storeApi](const std::string &storeId) {
+            storeApi->unsubscribeFromFileEvents(storeId);
+        });
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
 }
\ No newline at end of file
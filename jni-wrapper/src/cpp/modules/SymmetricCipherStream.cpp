@@ -0,0 +1,391 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include "../utils.hpp"
+#include "../exceptions.h"
+
+namespace {
+    /**
+     * AES-256-GCM stream. Encrypted form is MAGIC, IV, ciphertext and authentication tag;
+     * MAGIC is authenticated as additional data, so its version cannot be changed unnoticed.
+     * Decryption holds back the last TAG_SIZE bytes received, as they may turn out to be the tag.
+     */
+    class CipherStream {
+    public:
+        static constexpr size_t KEY_SIZE = 32;
+        // Identifies the stream format and its version, unlike output of CryptoApi::encryptDataSymmetric
+        static constexpr unsigned char MAGIC[] = {'P', 'M', 'X', 'S', 'G', 'C', 'M', 1};
+        static constexpr size_t MAGIC_SIZE = sizeof(MAGIC);
+        static constexpr size_t IV_SIZE = 12;
+        static constexpr size_t HEADER_SIZE = MAGIC_SIZE + IV_SIZE;
+        static constexpr size_t TAG_SIZE = 16;
+        // Output of update is at most this many bytes longer than its input
+        static constexpr size_t MAX_UPDATE_OVERHEAD = HEADER_SIZE + TAG_SIZE;
+        // Output of finish is at most this long
+        static constexpr size_t MAX_FINISH_SIZE = HEADER_SIZE + TAG_SIZE;
+
+        CipherStream(const unsigned char *key, size_t keySize, bool encrypt) : _encrypt(encrypt) {
+            if (keySize != KEY_SIZE) {
+                throw std::invalid_argument("Symmetric key must be 32 bytes long");
+            }
+            _ctx = EVP_CIPHER_CTX_new();
+            if (_ctx == nullptr ||
+                EVP_CipherInit_ex(_ctx, EVP_aes_256_gcm(), nullptr, nullptr, nullptr, encrypt ? 1 : 0) != 1 ||
+                EVP_CIPHER_CTX_ctrl(_ctx, EVP_CTRL_GCM_SET_IVLEN, IV_SIZE, nullptr) != 1 ||
+                EVP_CipherInit_ex(_ctx, nullptr, nullptr, key, nullptr, -1) != 1) {
+                EVP_CIPHER_CTX_free(_ctx);
+                throw std::runtime_error("Cannot initialize cipher");
+            }
+        }
+
+        ~CipherStream() {
+            EVP_CIPHER_CTX_free(_ctx);
+        }
+
+        CipherStream(const CipherStream &) = delete;
+
+        CipherStream &operator=(const CipherStream &) = delete;
+
+        /**
+         * Processes len bytes of input, writing at most len + MAX_UPDATE_OVERHEAD bytes to output.
+         * Returns number of bytes written.
+         */
+        size_t update(const unsigned char *input, size_t len, unsigned char *output) {
+            checkActive();
+            return _encrypt ? encryptUpdate(input, len, output) : decryptUpdate(input, len, output);
+        }
+
+        /**
+         * Finishes the stream, writing at most MAX_FINISH_SIZE bytes to output.
+         * Returns number of bytes written.
+         */
+        size_t finish(unsigned char *output) {
+            checkActive();
+            _finished = true;
+            return _encrypt ? encryptFinish(output) : decryptFinish();
+        }
+
+    private:
+        void checkActive() const {
+            if (_finished) {
+                throw IllegalStateException("This SymmetricCipherStream is already finished");
+            }
+        }
+
+        size_t encryptUpdate(const unsigned char *input, size_t len, unsigned char *output) {
+            size_t written = 0;
+            if (_headerSize == 0) {
+                written += startEncryption(output);
+            }
+            written += cipherUpdate(input, len, output + written);
+            return written;
+        }
+
+        size_t encryptFinish(unsigned char *output) {
+            size_t written = 0;
+            if (_headerSize == 0) {
+                written += startEncryption(output);
+            }
+            int len = 0;
+            if (EVP_EncryptFinal_ex(_ctx, output + written, &len) != 1 ||
+                EVP_CIPHER_CTX_ctrl(_ctx, EVP_CTRL_GCM_GET_TAG, TAG_SIZE, output + written + len) != 1) {
+                throw std::runtime_error("Cannot finish encryption");
+            }
+            return written + len + TAG_SIZE;
+        }
+
+        size_t startEncryption(unsigned char *output) {
+            std::memcpy(_header, MAGIC, MAGIC_SIZE);
+            if (RAND_bytes(_header + MAGIC_SIZE, IV_SIZE) != 1) {
+                throw std::runtime_error("Cannot generate IV");
+            }
+            _headerSize = HEADER_SIZE;
+            startCipher();
+            std::memcpy(output, _header, HEADER_SIZE);
+            return HEADER_SIZE;
+        }
+
+        size_t decryptUpdate(const unsigned char *input, size_t len, unsigned char *output) {
+            if (_headerSize < HEADER_SIZE) {
+                size_t headerPart = std::min(len, HEADER_SIZE - _headerSize);
+                std::memcpy(_header + _headerSize, input, headerPart);
+                _headerSize += headerPart;
+                input += headerPart;
+                len -= headerPart;
+                if (_headerSize < HEADER_SIZE) {
+                    return 0;
+                }
+                if (std::memcmp(_header, MAGIC, MAGIC_SIZE) != 0) {
+                    throw std::invalid_argument("Data was not encrypted by SymmetricCipherStream");
+                }
+                startCipher();
+            }
+            if (_tailSize + len <= TAG_SIZE) {
+                std::memcpy(_tail + _tailSize, input, len);
+                _tailSize += len;
+                return 0;
+            }
+            // Everything except the last TAG_SIZE bytes is ciphertext
+            size_t toDecrypt = _tailSize + len - TAG_SIZE;
+            size_t fromTail = std::min(_tailSize, toDecrypt);
+            size_t fromInput = toDecrypt - fromTail;
+            size_t written = cipherUpdate(_tail, fromTail, output);
+            written += cipherUpdate(input, fromInput, output + written);
+            std::memmove(_tail, _tail + fromTail, _tailSize - fromTail);
+            std::memcpy(_tail + (_tailSize - fromTail), input + fromInput, len - fromInput);
+            _tailSize = TAG_SIZE;
+            return written;
+        }
+
+        size_t decryptFinish() {
+            if (_headerSize < HEADER_SIZE || _tailSize < TAG_SIZE) {
+                throw std::runtime_error("Encrypted data is too short");
+            }
+            int len = 0;
+            unsigned char unused[TAG_SIZE];
+            if (EVP_CIPHER_CTX_ctrl(_ctx, EVP_CTRL_GCM_SET_TAG, TAG_SIZE, _tail) != 1 ||
+                EVP_DecryptFinal_ex(_ctx, unused, &len) != 1) {
+                throw std::runtime_error("Encrypted data is corrupted or the key is invalid");
+            }
+            return 0;
+        }
+
+        void startCipher() {
+            int outLen = 0;
+            if (EVP_CipherInit_ex(_ctx, nullptr, nullptr, nullptr, _header + MAGIC_SIZE, -1) != 1 ||
+                EVP_CipherUpdate(_ctx, nullptr, &outLen, _header, MAGIC_SIZE) != 1) {
+                throw std::runtime_error("Cannot initialize cipher");
+            }
+        }
+
+        size_t cipherUpdate(const unsigned char *input, size_t len, unsigned char *output) {
+            size_t written = 0;
+            // EVP takes int lengths
+            while (len > 0) {
+                int part = (int) std::min<size_t>(len, 1 << 30);
+                int outLen = 0;
+                if (EVP_CipherUpdate(_ctx, output + written, &outLen, input, part) != 1) {
+                    throw std::runtime_error("Cannot process data");
+                }
+                written += outLen;
+                input += part;
+                len -= part;
+            }
+            return written;
+        }
+
+        EVP_CIPHER_CTX *_ctx;
+        bool _encrypt;
+        bool _finished = false;
+        unsigned char _header[HEADER_SIZE];
+        size_t _headerSize = 0;
+        unsigned char _tail[TAG_SIZE];
+        size_t _tailSize = 0;
+    };
+
+    CipherStream *getCipherStream(JniContextUtils &ctx, jobject thiz) {
+        jclass cls = ctx->GetObjectClass(thiz);
+        jfieldID streamFID = ctx->GetFieldID(cls, "stream", "Ljava/lang/Long;");
+        jobject streamLong = ctx->GetObjectField(thiz, streamFID);
+        if (streamLong == nullptr) {
+            throw IllegalStateException("This SymmetricCipherStream instance cannot be used anymore");
+        }
+        return (CipherStream *) ctx.getObject(streamLong).getLongValue();
+    }
+
+    jbyteArray bytes2jByteArray(JniContextUtils &ctx, const std::vector<unsigned char> &bytes, size_t size) {
+        jbyteArray result = ctx->NewByteArray((jsize) size);
+        if (result != nullptr && size > 0) {
+            ctx->SetByteArrayRegion(result, 0, (jsize) size, (const jbyte *) bytes.data());
+        }
+        return result;
+    }
+
+    unsigned char *directAddress(JniContextUtils &ctx, jobject buffer, jint offset, jint length) {
+        auto address = (unsigned char *) ctx->GetDirectBufferAddress(buffer);
+        if (address == nullptr) {
+            throw std::invalid_argument("Buffer must be a direct ByteBuffer");
+        }
+        if (offset < 0 || length < 0 || offset + (jlong) length > ctx->GetDirectBufferCapacity(buffer)) {
+            throw std::invalid_argument("Buffer range is out of bounds");
+        }
+        return address + offset;
+    }
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SymmetricCipherStream_create(
+        JNIEnv *env,
+        jclass clazz,
+        jbyteArray symmetric_key,
+        jboolean encrypt
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(symmetric_key, "Symmetric key")) {
+        return 0;
+    }
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &symmetric_key, &encrypt]() {
+        auto key = ctx.jByteArray2String(symmetric_key);
+        auto stream = std::make_unique<CipherStream>(
+                (const unsigned char *) key.data(), key.size(), encrypt == JNI_TRUE);
+        std::fill(key.begin(), key.end(), '\0');
+        return (jlong) stream.release();
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SymmetricCipherStream_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    delete (CipherStream *) ptr;
+}
+
+extern "C"
+JNIEXPORT jbyteArray JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SymmetricCipherStream_update(
+        JNIEnv *env,
+        jobject thiz,
+        jbyteArray chunk
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(chunk, "Chunk")) {
+        return nullptr;
+    }
+    jbyteArray result;
+    ctx.callResultEndpointApi<jbyteArray>(&result, [&ctx, &thiz, &chunk]() {
+        auto stream = getCipherStream(ctx, thiz);
+        jsize size = ctx->GetArrayLength(chunk);
+        std::vector<unsigned char> output(size + CipherStream::MAX_UPDATE_OVERHEAD);
+        // Input is read in place; no JNI calls are made until it is released
+        auto input = (unsigned char *) ctx->GetPrimitiveArrayCritical(chunk, nullptr);
+        if (input == nullptr) {
+            throw std::runtime_error("Cannot access chunk");
+        }
+        size_t written;
+        try {
+            written = stream->update(input, size, output.data());
+        } catch (...) {
+            ctx->ReleasePrimitiveArrayCritical(chunk, input, JNI_ABORT);
+            throw;
+        }
+        ctx->ReleasePrimitiveArrayCritical(chunk, input, JNI_ABORT);
+        return bytes2jByteArray(ctx, output, written);
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jbyteArray JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SymmetricCipherStream_updateDirect(
+        JNIEnv *env,
+        jobject thiz,
+        jobject input,
+        jint offset,
+        jint length
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(input, "Input")) {
+        return nullptr;
+    }
+    jbyteArray result;
+    ctx.callResultEndpointApi<jbyteArray>(&result, [&ctx, &thiz, &input, &offset, &length]() {
+        auto stream = getCipherStream(ctx, thiz);
+        auto input_c = directAddress(ctx, input, offset, length);
+        std::vector<unsigned char> output(length + CipherStream::MAX_UPDATE_OVERHEAD);
+        size_t written = stream->update(input_c, length, output.data());
+        return bytes2jByteArray(ctx, output, written);
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SymmetricCipherStream_updateDirectInto(
+        JNIEnv *env,
+        jobject thiz,
+        jobject input,
+        jint input_offset,
+        jint length,
+        jobject output,
+        jint output_offset,
+        jint output_length
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(input, "Input") ||
+        ctx.nullCheck(output, "Output")) {
+        return 0;
+    }
+    jint result = 0;
+    ctx.callResultEndpointApi<jint>(
+            &result,
+            [&ctx, &thiz, &input, &input_offset, &length, &output, &output_offset, &output_length]() {
+                auto stream = getCipherStream(ctx, thiz);
+                auto input_c = directAddress(ctx, input, input_offset, length);
+                auto output_c = directAddress(ctx, output, output_offset, output_length);
+                if ((size_t) output_length < length + CipherStream::MAX_UPDATE_OVERHEAD) {
+                    throw std::invalid_argument("Output buffer is too small");
+                }
+                // Output may run ahead of input by the header or the held back tail
+                auto inputAddress = (uintptr_t) input_c;
+                auto outputAddress = (uintptr_t) output_c;
+                if (inputAddress < outputAddress + output_length && outputAddress < inputAddress + length) {
+                    throw std::invalid_argument("Input and output ranges must not overlap");
+                }
+                return (jint) stream->update(input_c, length, output_c);
+            });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jbyteArray JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_crypto_SymmetricCipherStream_doFinal(
+        JNIEnv *env,
+        jobject thiz
+) {
+    JniContextUtils ctx(env);
+    jbyteArray result;
+    ctx.callResultEndpointApi<jbyteArray>(&result, [&ctx, &thiz]() {
+        std::vector<unsigned char> output(CipherStream::MAX_FINISH_SIZE);
+        size_t written = getCipherStream(ctx, thiz)->finish(output.data());
+        return bytes2jByteArray(ctx, output, written);
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
@@ -15,6 +15,7 @@
 #include "Connection.h"
 #include "ThreadApi.h"
 #include "../utils.hpp"
+#include "../bulk.h"
 #include "../parser.h"
 #include "../exceptions.h"
 #include "Connection.h"
@@ -100,23 +101,18 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_createThread(
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &thiz, &context_id, &users, &managers, &public_meta, &private_meta, &container_policies]() {
-                std::vector<core::UserWithPubKey> users_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(users));
-                std::vector<core::UserWithPubKey> managers_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(managers));
-                auto container_policies_opt = std::optional<core::ContainerPolicy>(
-                        parseContainerPolicy(ctx, container_policies));
-                return ctx->NewStringUTF(
+                UsersArg users_c(ctx, users);
+                UsersArg managers_c(ctx, managers);
+                ContainerPolicyArg container_policies_opt(ctx, container_policies);
+                return ctx.string2jString(
                         getThreadApi(ctx, thiz)->createThread(
                                 ctx.jString2string(context_id),
-                                users_c,
-                                managers_c,
+                                users_c.get(),
+                                managers_c.get(),
                                 core::Buffer::from(ctx.jByteArray2String(public_meta)),
                                 core::Buffer::from(ctx.jByteArray2String(private_meta)),
-                                container_policies_opt
-                        ).c_str());
+                                container_policies_opt.get()
+                        ));
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -150,69 +146,34 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_getThread(
     return result;
 }
 
-extern "C"
-JNIEXPORT jobject JNICALL
-Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listThreads(
+static jobject listThreads(
         JNIEnv *env,
         jobject thiz,
         jstring context_id,
-        jlong skip,
-        jlong limit,
-        jstring sort_order,
-        jstring last_id,
-        jstring query_as_json
+        const PagingQueryArgs &paging
 ) {
     JniContextUtils ctx(env);
     if (ctx.nullCheck(context_id, "Context ID") ||
-        ctx.nullCheck(sort_order, "Sort order")) {
+        paging.nullCheck(ctx)) {
         return nullptr;
     }
     jobject result;
     ctx.callResultEndpointApi<jobject>(
             &result,
-            [&ctx, &thiz, &context_id, &skip, &limit, &sort_order, &last_id, &query_as_json]() {
-                jclass pagingListCls = ctx->FindClass(
-                        "com/simplito/kotlin/privmx_endpoint/model/PagingList");
-                jmethodID pagingListInitMID = ctx->GetMethodID(pagingListCls, "<init>",
-                                                               "(Ljava/lang/Long;Ljava/util/List;)V");
-                jclass arrayCls = ctx->FindClass("java/util/ArrayList");
-                jmethodID initArrayMID = ctx->GetMethodID(
-                        arrayCls,
-                        "<init>",
-                        "()V");
-                jmethodID addToArrayMID = ctx->GetMethodID(
-                        arrayCls,
-                        "add",
-                        "(Ljava/lang/Object;)Z");
-                auto query = core::PagingQuery();
-                query.skip = skip;
-                query.limit = limit;
-                query.sortOrder = ctx.jString2string(sort_order);
-                if (last_id != nullptr) {
-                    query.lastId = ctx.jString2string(last_id);
-                }
-                if (query_as_json != nullptr) {
-                    query.queryAsJson = ctx.jString2string(query_as_json);
-                }
+            [&ctx, &thiz, &context_id, &paging]() {
+                auto query = paging.toPagingQuery(ctx);
                 core::PagingList<thread::Thread>
                         threads_c = getThreadApi(ctx, thiz)->listThreads(
                         ctx.jString2string(context_id),
                         query
                 );
-                jobject array = ctx->NewObject(arrayCls, initArrayMID);
-                for (auto &thread_c: threads_c.readItems) {
-                    ctx->CallBooleanMethod(
-                            array,
-                            addToArrayMID,
-                            privmx::wrapper::thread2Java(ctx, thread_c)
-                    );
-                }
-                return ctx->NewObject(
-                        pagingListCls,
-                        pagingListInitMID,
-                        ctx.long2jLong(threads_c.totalAvailable),
-                        array
-                );
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return privmx::wrapper::pagingList2Java(
+                        ctx,
+                        threads_c,
+                        [&ctx](auto &thread_c) {
+                            return privmx::wrapper::thread2Java(ctx, thread_c);
+                        });
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -220,6 +181,37 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listThreads(
     return result;
 }
 
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listThreads(
+        JNIEnv *env,
+        jobject thiz,
+        jstring context_id,
+        jlong skip,
+        jlong limit,
+        jstring sort_order,
+        jstring last_id,
+        jstring query_as_json
+) {
+    return listThreads(env, thiz, context_id,
+                       PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json));
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listThreadsPrepared(
+        JNIEnv *env,
+        jobject thiz,
+        jstring context_id,
+        jlong skip,
+        jlong limit,
+        jobject prepared_query,
+        jstring last_id
+) {
+    return listThreads(env, thiz, context_id,
+                       PagingQueryArgs::prepared(skip, limit, prepared_query, last_id));
+}
+
 extern "C"
 JNIEXPORT jstring JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_sendMessage(
@@ -241,13 +233,95 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_sendMessage(
     ctx.callResultEndpointApi<jstring>(
             &result,
             [&ctx, &thiz, &thread_id, &public_meta, &private_meta, &data]() {
-                return ctx->NewStringUTF(
+                return ctx.string2jString(
                         getThreadApi(ctx, thiz)->sendMessage(
                                 ctx.jString2string(thread_id),
                                 core::Buffer::from(ctx.jByteArray2String(public_meta)),
                                 core::Buffer::from(ctx.jByteArray2String(private_meta)),
                                 core::Buffer::from(ctx.jByteArray2String(data))
-                        ).c_str());
+                        ));
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_sendMessageAsync(
+        JNIEnv *env,
+        jobject thiz,
+        jstring thread_id,
+        jbyteArray public_meta,
+        jbyteArray private_meta,
+        jbyteArray data,
+        jobject token
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(thread_id, "Thread ID") ||
+        ctx.nullCheck(public_meta, "Public meta") ||
+        ctx.nullCheck(private_meta, "Private meta") ||
+        ctx.nullCheck(data, "Data")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &thread_id, &public_meta, &private_meta, &data, &token]() {
+                // Copy shares the native API and stays valid if the instance is closed meanwhile
+                thread::ThreadApi api = *getThreadApi(ctx, thiz);
+                auto token_c = privmx::wrapper::getCancellationState(ctx, token);
+                auto threadId_c = ctx.jString2string(thread_id);
+                auto publicMeta_c = core::Buffer::from(ctx.jByteArray2String(public_meta));
+                auto privateMeta_c = core::Buffer::from(ctx.jByteArray2String(private_meta));
+                auto data_c = core::Buffer::from(ctx.jByteArray2String(data));
+                return ctx.callAsyncEndpointApi(
+                        ctx->GetObjectClass(thiz),
+                        token_c,
+                        [api, threadId_c, publicMeta_c, privateMeta_c, data_c]() mutable {
+                            return api.sendMessage(threadId_c, publicMeta_c, privateMeta_c, data_c);
+                        },
+                        [](JniContextUtils &ctx, std::string &messageId_c) -> jobject {
+                            return ctx.string2jString(messageId_c);
+                        });
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+static jobject listMessages(
+        JNIEnv *env,
+        jobject thiz,
+        jstring thread_id,
+        const PagingQueryArgs &paging,
+        jint fields
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(thread_id, "Thread ID") ||
+        paging.nullCheck(ctx)) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &thread_id, &paging, &fields]() {
+                auto query = paging.toPagingQuery(ctx);
+                core::PagingList<thread::Message> messages_c = getThreadApi(
+                        ctx,
+                        thiz)->
+                        listMessages(
+                        ctx.jString2string(thread_id),
+                        query);
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return privmx::wrapper::pagingList2Java(
+                        ctx,
+                        messages_c,
+                        [&ctx, &fields](auto &threadMessage_c) {
+                            return privmx::wrapper::message2Java(ctx, threadMessage_c, fields);
+                        });
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -266,51 +340,125 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listMessages(
         jstring sort_order,
         jstring last_id,
         jstring query_as_json
+) {
+    return listMessages(env, thiz, thread_id,
+                        PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json),
+                        privmx::wrapper::projection::ALL);
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listMessagesProjected(
+        JNIEnv *env,
+        jobject thiz,
+        jstring thread_id,
+        jlong skip,
+        jlong limit,
+        jstring sort_order,
+        jstring last_id,
+        jstring query_as_json,
+        jint fields
+) {
+    return listMessages(env, thiz, thread_id,
+                        PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json),
+                        fields);
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listMessagesPrepared(
+        JNIEnv *env,
+        jobject thiz,
+        jstring thread_id,
+        jlong skip,
+        jlong limit,
+        jobject prepared_query,
+        jstring last_id,
+        jint fields
+) {
+    return listMessages(env, thiz, thread_id,
+                        PagingQueryArgs::prepared(skip, limit, prepared_query, last_id), fields);
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listMessagesAsync(
+        JNIEnv *env,
+        jobject thiz,
+        jstring thread_id,
+        jlong skip,
+        jlong limit,
+        jstring sort_order,
+        jstring last_id,
+        jstring query_as_json,
+        jobject token
 ) {
     JniContextUtils ctx(env);
+    auto paging = PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json);
     if (ctx.nullCheck(thread_id, "Thread ID") ||
-        ctx.nullCheck(sort_order, "Sort order")) {
+        paging.nullCheck(ctx)) {
         return nullptr;
     }
     jobject result;
     ctx.callResultEndpointApi<jobject>(
             &result,
-            [&ctx, &thiz, &thread_id, &skip, &limit, &sort_order, &last_id, &query_as_json]() {
-                jclass pagingListCls = ctx->FindClass(
-                        "com/simplito/kotlin/privmx_endpoint/model/PagingList");
-                jmethodID pagingListInitMID = ctx->GetMethodID(pagingListCls, "<init>",
-                                                               "(Ljava/lang/Long;Ljava/util/List;)V");
-                jclass arrayCls = ctx->FindClass("java/util/ArrayList");
-                jmethodID initArrayMID = ctx->GetMethodID(arrayCls, "<init>", "()V");
-                jmethodID addToArrayMID = ctx->GetMethodID(arrayCls, "add",
-                                                           "(Ljava/lang/Object;)Z");
-                auto query = core::PagingQuery();
-                query.skip = skip;
-                query.limit = limit;
-                query.sortOrder = ctx.jString2string(sort_order);
-                if (last_id != nullptr) {
-                    query.lastId = ctx.jString2string(last_id);
-                }
-                if (query_as_json != nullptr) {
-                    query.queryAsJson = ctx.jString2string(query_as_json);
-                }
+            [&ctx, &thiz, &thread_id, &paging, &token]() {
+                // Copy shares the native API and stays valid if the instance is closed meanwhile
+                thread::ThreadApi api = *getThreadApi(ctx, thiz);
+                auto token_c = privmx::wrapper::getCancellationState(ctx, token);
+                auto threadId_c = ctx.jString2string(thread_id);
+                auto query = paging.toPagingQuery(ctx);
+                return ctx.callAsyncEndpointApi(
+                        ctx->GetObjectClass(thiz),
+                        token_c,
+                        [api, threadId_c, query]() mutable {
+                            return api.listMessages(threadId_c, query);
+                        },
+                        [](JniContextUtils &ctx, core::PagingList<thread::Message> &messages_c) {
+                            JniContextUtils::StringInterningScope stringInterning(ctx);
+                            return privmx::wrapper::pagingList2Java(
+                                    ctx,
+                                    messages_c,
+                                    [&ctx](auto &threadMessage_c) {
+                                        return privmx::wrapper::message2Java(ctx, threadMessage_c);
+                                    });
+                        });
+            });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
+static jobject listMessagesLazy(
+        JNIEnv *env,
+        jobject thiz,
+        jstring thread_id,
+        const PagingQueryArgs &paging
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(thread_id, "Thread ID") ||
+        paging.nullCheck(ctx)) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &thiz, &thread_id, &paging]() {
+                auto query = paging.toPagingQuery(ctx);
                 core::PagingList<thread::Message> messages_c = getThreadApi(
                         ctx,
                         thiz)->
                         listMessages(
                         ctx.jString2string(thread_id),
                         query);
-                jobject array = ctx->NewObject(arrayCls, initArrayMID);
-                for (auto &threadMessage_c: messages_c.readItems) {
-                    ctx->CallBooleanMethod(array,
-                                           addToArrayMID,
-                                           privmx::wrapper::message2Java(ctx, threadMessage_c));
-                }
-                return ctx->NewObject(
-                        pagingListCls,
-                        pagingListInitMID,
-                        ctx.long2jLong(messages_c.totalAvailable),
-                        array);
+                JniContextUtils::StringInterningScope stringInterning(ctx);
+                return privmx::wrapper::pagingList2Java(
+                        ctx,
+                        messages_c,
+                        [&ctx](auto &threadMessage_c) {
+                            return privmx::wrapper::lazyMessage2Java(ctx, std::move(threadMessage_c));
+                        });
             });
     if (ctx->ExceptionCheck()) {
         return nullptr;
@@ -318,6 +466,37 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listMessages(
     return result;
 }
 
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listMessagesLazy(
+        JNIEnv *env,
+        jobject thiz,
+        jstring thread_id,
+        jlong skip,
+        jlong limit,
+        jstring sort_order,
+        jstring last_id,
+        jstring query_as_json
+) {
+    return listMessagesLazy(env, thiz, thread_id,
+                            PagingQueryArgs::of(skip, limit, sort_order, last_id, query_as_json));
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_listMessagesLazyPrepared(
+        JNIEnv *env,
+        jobject thiz,
+        jstring thread_id,
+        jlong skip,
+        jlong limit,
+        jobject prepared_query,
+        jstring last_id
+) {
+    return listMessagesLazy(env, thiz, thread_id,
+                            PagingQueryArgs::prepared(skip, limit, prepared_query, last_id));
+}
+
 extern "C"
 JNIEXPORT void JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_deleteThread(
@@ -390,33 +569,70 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_updateThread(
                     &force,
                     &force_generate_new_key,
                     &container_policies]() {
-                std::vector<core::UserWithPubKey> users_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(users));
-                std::vector<core::UserWithPubKey> managers_c = usersToVector(
-                        ctx,
-                        ctx.jObject2jArray(managers));
-                auto container_policies_opt = std::optional<core::ContainerPolicy>(
-                        parseContainerPolicy(ctx, container_policies));
+                UsersArg users_c(ctx, users);
+                UsersArg managers_c(ctx, managers);
+                ContainerPolicyArg container_policies_opt(ctx, container_policies);
                 getThreadApi(ctx, thiz)->updateThread(
                         ctx.jString2string(thread_id),
-                        users_c,
-                        managers_c,
+                        users_c.get(),
+                        managers_c.get(),
                         core::Buffer::from(ctx.jByteArray2String(public_meta)),
                         core::Buffer::from(ctx.jByteArray2String(private_meta)),
                         version,
                         force == JNI_TRUE,
                         force_generate_new_key == JNI_TRUE,
-                        container_policies_opt);
+                        container_policies_opt.get());
             });
 }
 
+static jobject getMessage(JNIEnv *env, jobject thiz, jstring message_id, jint fields) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(message_id, "Message ID")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &message_id, &fields]() {
+        return privmx::wrapper::message2Java(
+                ctx,
+                getThreadApi(ctx, thiz)->getMessage(
+                        ctx.jString2string(message_id)
+                ),
+                fields
+        );
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
 extern "C"
 JNIEXPORT jobject JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_getMessage(
         JNIEnv *env,
         jobject thiz,
         jstring message_id
+) {
+    return getMessage(env, thiz, message_id, privmx::wrapper::projection::ALL);
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_getMessageProjected(
+        JNIEnv *env,
+        jobject thiz,
+        jstring message_id,
+        jint fields
+) {
+    return getMessage(env, thiz, message_id, fields);
+}
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_getMessageLazy(
+        JNIEnv *env,
+        jobject thiz,
+        jstring message_id
 ) {
     JniContextUtils ctx(env);
     if (ctx.nullCheck(message_id, "Message ID")) {
@@ -424,7 +640,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_getMessage(
     }
     jobject result;
     ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &message_id]() {
-        return privmx::wrapper::message2Java(
+        return privmx::wrapper::lazyMessage2Java(
                 ctx,
                 getThreadApi(ctx, thiz)->getMessage(
                         ctx.jString2string(message_id)
@@ -503,6 +719,29 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_subscribeForM
     });
 }
 extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_subscribeForMessageEventsBulk(
+        JNIEnv *env,
+        jobject thiz,
+        jobject thread_ids
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(thread_ids, "Thread IDs")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &thread_ids]() {
+        auto threadApi = getThreadApi(ctx, thiz);
+        return privmx::wrapper::forEachIdParallel(ctx, thread_ids, [threadApi](const std::string &threadId) {
+            threadApi->subscribeForMessageEvents(threadId);
+        });
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+extern "C"
 JNIEXPORT void JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_unsubscribeFromMessageEvents(
         JNIEnv *env,
@@ -518,4 +757,27 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_unsubscribeFr
                 ctx.jString2string(thread_id)
         );
     });
+}
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_thread_ThreadApi_unsubscribeFromMessageEventsBulk(
+        JNIEnv *env,
+        jobject thiz,
+        jobject thread_ids
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(thread_ids, "Thread IDs")) {
+        return nullptr;
+    }
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(&result, [&ctx, &thiz, &thread_ids]() {
+        auto threadApi = getThreadApi(ctx, thiz);
+        return privmx::wrapper::forEachIdParallel(ctx, thread_ids, [threadApi](const std::string &threadId) {
+            threadApi->unsubscribeFromMessageEvents(threadId);
+        });
+    });
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
 }
\ No newline at end of file
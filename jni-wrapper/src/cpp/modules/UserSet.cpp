@@ -0,0 +1,48 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <jni.h>
+#include <privmx/endpoint/core/Types.hpp>
+#include "../utils.hpp"
+#include "../parser.h"
+
+using namespace privmx::endpoint;
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_UserSet_create(
+        JNIEnv *env,
+        jclass clazz,
+        jobjectArray users
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(users, "Users list")) {
+        return 0;
+    }
+    jlong result = 0;
+    ctx.callResultEndpointApi<jlong>(&result, [&ctx, &users]() {
+        return (jlong) new std::vector<core::UserWithPubKey>(usersToVector(ctx, users));
+    });
+    if (ctx->ExceptionCheck()) {
+        return 0;
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_UserSet_free(
+        JNIEnv *env,
+        jclass clazz,
+        jlong ptr
+) {
+    delete (std::vector<core::UserWithPubKey> *) ptr;
+}
@@ -51,22 +51,13 @@ privmx::wrapper::UserVerifierInterfaceJNI::verify(
             "verify",
             "(Ljava/util/List;)Ljava/util/List;");
 
-    jclass arrayClass = env->FindClass("java/util/ArrayList");
-    jmethodID initArrayMID = env->GetMethodID(
-            arrayClass,
-            "<init>",
-            "()V");
-
-    jobject jverificationRequestArray = env->NewObject(arrayClass, initArrayMID);
-    jmethodID addToArrayMID = env->GetMethodID(
-            arrayClass,
-            "add",
-            "(Ljava/lang/Object;)Z");
-
-    for (auto &request_c: request) {
-        env->CallBooleanMethod(jverificationRequestArray,
-                               addToArrayMID,
-                               privmx::wrapper::verificationRequest2Java(ctx, request_c));
+    jobject jverificationRequestArray = ctx.vector2jList(
+            request,
+            [&ctx](const privmx::endpoint::core::VerificationRequest &request_c) {
+                return privmx::wrapper::verificationRequest2Java(ctx, request_c);
+            });
+    if (jverificationRequestArray == nullptr) {
+        return std::vector<bool>(request.size(), true);
     }
 
     auto jResult = env->CallObjectMethod(
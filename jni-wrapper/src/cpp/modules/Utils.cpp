@@ -10,6 +10,7 @@
 //
 
 #include "../utils.hpp"
+#include "../model_native_initializers.h"
 #include <jni.h>
 #include <privmx/endpoint/core/Utils.hpp>
 
@@ -29,7 +30,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_utils_Utils_trim(
             &result,
             [&ctx, &clazz, &data]() {
                 auto response = privmx::endpoint::core::Utils::trim(ctx.jString2string(data));
-                return ctx->NewStringUTF(response.c_str());
+                return ctx.string2jString(response);
             }
     );
 
@@ -60,21 +61,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_utils_Utils_split(
                         ctx.jString2string(data),
                         ctx.jString2string(delimiter));
 
-                jclass arrayListCls = env->FindClass("java/util/ArrayList");
-                jmethodID initMID = env->GetMethodID(arrayListCls, "<init>", "()V");
-                jmethodID addToListMID = env->GetMethodID(arrayListCls, "add",
-                                                          "(Ljava/lang/Object;)Z");
-                jobject array = env->NewObject(arrayListCls, initMID);
-
-                for (auto &value: response) {
-                    env->CallBooleanMethod(
-                            array,
-                            addToListMID,
-                            ctx->NewStringUTF(value.c_str())
-                    );
-                }
-
-                return array;
+                return ctx.strings2jList(response);
             }
     );
 
@@ -100,7 +87,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_utils_Utils_ltrim(
             [&ctx, &data]() {
                 std::string data_n = ctx.jString2string(data);
                 privmx::endpoint::core::Utils::ltrim(data_n);
-                return ctx->NewStringUTF(data_n.c_str());
+                return ctx.string2jString(data_n);
             }
     );
 
@@ -126,7 +113,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_utils_Utils_rtrim(
             [&ctx, &data]() {
                 std::string data_n = ctx.jString2string(data);
                 privmx::endpoint::core::Utils::rtrim(data_n);
-                return ctx->NewStringUTF(data_n.c_str());
+                return ctx.string2jString(data_n);
             }
     );
 
@@ -154,7 +141,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_utils_Hex_encode(
             [&ctx, &data]() {
                 auto encoded = privmx::endpoint::core::Hex::encode(
                         privmx::endpoint::core::Buffer::from(ctx.jByteArray2String(data)));
-                return ctx->NewStringUTF(encoded.c_str());
+                return ctx.string2jString(encoded);
             }
     );
 
@@ -192,6 +179,33 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_utils_Hex_decode(
     return result;
 }
 
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_simplito_kotlin_privmx_1endpoint_modules_core_utils_Hex_decodeDirect(
+        JNIEnv *env,
+        jclass clazz,
+        jstring hex_data
+) {
+    JniContextUtils ctx(env);
+    if (ctx.nullCheck(hex_data, "Data")) return nullptr;
+
+    jobject result;
+    ctx.callResultEndpointApi<jobject>(
+            &result,
+            [&ctx, &hex_data]() {
+                return privmx::wrapper::nativeBuffer2Java(
+                        ctx,
+                        privmx::endpoint::core::Hex::decode(ctx.jString2string(hex_data))
+                );
+            }
+    );
+
+    if (ctx->ExceptionCheck()) {
+        return nullptr;
+    }
+    return result;
+}
+
 extern "C"
 JNIEXPORT jboolean JNICALL
 Java_com_simplito_kotlin_privmx_1endpoint_modules_core_utils_Hex_is(
@@ -234,7 +248,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_utils_Base32_encode(
             [&ctx, &data]() {
                 auto encoded = privmx::endpoint::core::Base32::encode(
                         privmx::endpoint::core::Buffer::from(ctx.jByteArray2String(data)));
-                return ctx->NewStringUTF(encoded.c_str());
+                return ctx.string2jString(encoded);
             }
     );
 
@@ -315,7 +329,7 @@ Java_com_simplito_kotlin_privmx_1endpoint_modules_core_utils_Base64_encode(
             [&ctx, &data]() {
                 auto encoded = privmx::endpoint::core::Base64::encode(
                         privmx::endpoint::core::Buffer::from(ctx.jByteArray2String(data)));
-                return ctx->NewStringUTF(encoded.c_str());
+                return ctx.string2jString(encoded);
             }
     );
 
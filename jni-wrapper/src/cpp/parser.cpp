@@ -15,25 +15,143 @@ using namespace privmx::endpoint;
 
 std::vector<privmx::endpoint::core::UserWithPubKey>
 usersToVector(JniContextUtils &ctx, jobjectArray users) {
+    jsize length = ctx->GetArrayLength(users);
     std::vector<privmx::endpoint::core::UserWithPubKey> users_c;
-    for (int i = 0; i < ctx->GetArrayLength(users); i++) {
-
+    users_c.reserve(length);
+    jfieldID pubKeyFID = nullptr;
+    jfieldID userIdFID = nullptr;
+    for (jsize i = 0; i < length; i++) {
         jobject arrayElement = ctx->GetObjectArrayElement(users, i);
-        jclass arrayElementCls = ctx->GetObjectClass(arrayElement);
-
-        jfieldID pubKeyFID = ctx->GetFieldID(arrayElementCls, "pubKey", "Ljava/lang/String;");
-        jfieldID userIdFID = ctx->GetFieldID(arrayElementCls, "userId", "Ljava/lang/String;");
+        if (pubKeyFID == nullptr) {
+            jclass arrayElementCls = ctx->GetObjectClass(arrayElement);
+            pubKeyFID = ctx->GetFieldID(arrayElementCls, "pubKey", "Ljava/lang/String;");
+            userIdFID = ctx->GetFieldID(arrayElementCls, "userId", "Ljava/lang/String;");
+            ctx->DeleteLocalRef(arrayElementCls);
+        }
+        jstring userId = (jstring) ctx->GetObjectField(arrayElement, userIdFID);
+        jstring pubKey = (jstring) ctx->GetObjectField(arrayElement, pubKeyFID);
         privmx::endpoint::core::UserWithPubKey user = privmx::endpoint::core::UserWithPubKey();
-        user.userId = ctx.jString2string(
-                (jstring) ctx->GetObjectField(arrayElement, userIdFID));
-        user.pubKey = ctx.jString2string(
-                (jstring) ctx->GetObjectField(arrayElement, pubKeyFID));
-
-        users_c.push_back(user);
+        user.userId = ctx.jString2string(userId);
+        user.pubKey = ctx.jString2string(pubKey);
+        users_c.push_back(std::move(user));
+        ctx->DeleteLocalRef(userId);
+        ctx->DeleteLocalRef(pubKey);
+        ctx->DeleteLocalRef(arrayElement);
     }
     return users_c;
 }
 
+namespace {
+    std::atomic<jclass> userSetCls{nullptr};
+    std::atomic<jclass> preparedContainerPolicyCls{nullptr};
+    std::atomic<jclass> preparedContainerPolicyWithoutItemCls{nullptr};
+
+    // Returns native copy of given policy, or nullptr when it is not prepared or was closed
+    PreparedPolicy *getPreparedPolicy(JniContextUtils &ctx, jobject policy) {
+        if (policy == nullptr) {
+            return nullptr;
+        }
+        jclass classes[] = {
+                ctx.cachedClass(preparedContainerPolicyCls,
+                                "com/simplito/kotlin/privmx_endpoint/modules/core/PreparedContainerPolicy"),
+                ctx.cachedClass(preparedContainerPolicyWithoutItemCls,
+                                "com/simplito/kotlin/privmx_endpoint/modules/core/PreparedContainerPolicyWithoutItem")
+        };
+        for (jclass cls: classes) {
+            if (cls == nullptr) {
+                ctx->ExceptionClear();
+                continue;
+            }
+            if (!ctx->IsInstanceOf(policy, cls)) {
+                continue;
+            }
+            jfieldID preparedPolicyFID = ctx->GetFieldID(cls, "preparedPolicy", "Ljava/lang/Long;");
+            jobject preparedPolicyLong = ctx->GetObjectField(policy, preparedPolicyFID);
+            if (preparedPolicyLong == nullptr) {
+                return nullptr;
+            }
+            auto result = (PreparedPolicy *) ctx.getObject(preparedPolicyLong).getLongValue();
+            ctx->DeleteLocalRef(preparedPolicyLong);
+            return result;
+        }
+        return nullptr;
+    }
+}
+
+UsersArg::UsersArg(JniContextUtils &ctx, jobject users) : _users(&_parsed) {
+    jclass cls = ctx.cachedClass(userSetCls, "com/simplito/kotlin/privmx_endpoint/modules/core/UserSet");
+    if (cls == nullptr) {
+        ctx->ExceptionClear();
+    } else if (ctx->IsInstanceOf(users, cls)) {
+        jfieldID userSetFID = ctx->GetFieldID(cls, "userSet", "Ljava/lang/Long;");
+        jobject userSetLong = ctx->GetObjectField(users, userSetFID);
+        if (userSetLong != nullptr) {
+            _users = (std::vector<privmx::endpoint::core::UserWithPubKey> *)
+                    ctx.getObject(userSetLong).getLongValue();
+            ctx->DeleteLocalRef(userSetLong);
+            return;
+        }
+    }
+    // Plain list or closed UserSet
+    _parsed = usersToVector(ctx, ctx.jObject2jArray(users));
+}
+
+ContainerPolicyArg::ContainerPolicyArg(JniContextUtils &ctx, jobject policy) : _policy(&_parsed) {
+    PreparedPolicy *prepared = getPreparedPolicy(ctx, policy);
+    if (prepared != nullptr && prepared->policy.has_value()) {
+        _policy = &prepared->policy;
+        return;
+    }
+    _parsed = parseContainerPolicy(ctx, policy);
+}
+
+ContainerPolicyWithoutItemArg::ContainerPolicyWithoutItemArg(JniContextUtils &ctx, jobject policy)
+        : _policy(&_parsed) {
+    PreparedPolicy *prepared = getPreparedPolicy(ctx, policy);
+    if (prepared != nullptr) {
+        _policy = &prepared->policyWithoutItem;
+        return;
+    }
+    _parsed = parseContainerPolicyWithoutItem(ctx, policy);
+}
+
+bool PagingQueryArgs::nullCheck(JniContextUtils &ctx) const {
+    if (isPrepared) {
+        return ctx.nullCheck(preparedQuery, "Prepared query");
+    }
+    return ctx.nullCheck(sortOrder, "Sort order");
+}
+
+privmx::endpoint::core::PagingQuery PagingQueryArgs::toPagingQuery(JniContextUtils &ctx) const {
+    auto query = privmx::endpoint::core::PagingQuery();
+    query.skip = skip;
+    query.limit = limit;
+    if (isPrepared) {
+        jclass cls = ctx->GetObjectClass(preparedQuery);
+        jfieldID preparedFID = ctx->GetFieldID(cls, "prepared", "Ljava/lang/Long;");
+        jobject preparedLong = ctx->GetObjectField(preparedQuery, preparedFID);
+        ctx->DeleteLocalRef(cls);
+        if (preparedLong == nullptr) {
+            throw IllegalStateException("This PreparedQuery instance cannot be used anymore");
+        }
+        auto prepared = (PreparedQuery *) ctx.getObject(preparedLong).getLongValue();
+        ctx->DeleteLocalRef(preparedLong);
+        query.sortOrder = prepared->sortOrder;
+        if (prepared->queryAsJson.has_value()) {
+            query.queryAsJson = prepared->queryAsJson.value();
+        }
+    } else {
+        query.sortOrder = ctx.jString2string(sortOrder);
+        if (queryAsJson != nullptr) {
+            query.queryAsJson = ctx.jString2string(queryAsJson);
+        }
+    }
+    if (lastId != nullptr) {
+        query.lastId = ctx.jString2string(lastId);
+    }
+    return query;
+}
+
 privmx::endpoint::core::PKIVerificationOptions
 parsePKIVerificationOptions(JniContextUtils &ctx, jobject pkiVerificationOptions) {
     auto result = privmx::endpoint::core::PKIVerificationOptions();
@@ -180,7 +298,7 @@ parseItemPolicy(JniContextUtils &ctx, jobject itemPolicy) {
 
 privmx::endpoint::inbox::FilesConfig parseFilesConfig(JniContextUtils &ctx, jobject filesConfig) {
     auto result = privmx::endpoint::inbox::FilesConfig();
-    jclass filesConfigCls = ctx->FindClass(
+    jclass filesConfigCls = ctx.findClass(
             "com/simplito/kotlin/privmx_endpoint/model/FilesConfig");
     jfieldID minCountFID = ctx->GetFieldID(filesConfigCls, "minCount", "Ljava/lang/Long;");
     jfieldID maxCountFID = ctx->GetFieldID(filesConfigCls, "maxCount", "Ljava/lang/Long;");
@@ -199,7 +317,7 @@ privmx::endpoint::inbox::FilesConfig parseFilesConfig(JniContextUtils &ctx, jobj
 jobject initEvent(JniContextUtils &ctx, std::string type, std::string channel, int64_t connectionId,
                   jobject data_j) {
     if (type.empty()) return nullptr;
-    jclass eventCls = ctx->FindClass("com/simplito/kotlin/privmx_endpoint/model/Event");
+    jclass eventCls = ctx.findClass("com/simplito/kotlin/privmx_endpoint/model/Event");
     jmethodID eventInitMID = ctx->GetMethodID(
             eventCls,
             "<init>",
@@ -213,8 +331,8 @@ jobject initEvent(JniContextUtils &ctx, std::string type, std::string channel, i
     return ctx->NewObject(
             eventCls,
             eventInitMID,
-            ctx->NewStringUTF(type.c_str()),
-            ctx->NewStringUTF(channel.c_str()),
+            ctx.string2jString(type),
+            ctx.string2jString(channel),
             ctx.long2jLong(connectionId),
             data_j
     );
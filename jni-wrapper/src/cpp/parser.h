@@ -15,11 +15,113 @@
 #include "utils.hpp"
 
 #include <jni.h>
+#include <optional>
 #include "model_native_initializers.h"
 
 std::vector<privmx::endpoint::core::UserWithPubKey>
 usersToVector(JniContextUtils &ctx, jobjectArray users);
 
+/**
+ * Users passed from Java as List<UserWithPubKey>.
+ * When the list is a UserSet, its native copy is used without reading the list elements.
+ */
+class UsersArg {
+public:
+    UsersArg(JniContextUtils &ctx, jobject users);
+
+    UsersArg(const UsersArg &) = delete;
+
+    UsersArg &operator=(const UsersArg &) = delete;
+
+    const std::vector<privmx::endpoint::core::UserWithPubKey> &get() const { return *_users; }
+
+private:
+    std::vector<privmx::endpoint::core::UserWithPubKey> _parsed;
+    const std::vector<privmx::endpoint::core::UserWithPubKey> *_users;
+};
+
+/**
+ * Native copy of a policy created with PreparedContainerPolicy or PreparedContainerPolicyWithoutItem.
+ */
+struct PreparedPolicy {
+    std::optional<privmx::endpoint::core::ContainerPolicyWithoutItem> policyWithoutItem;
+    // Empty when prepared from ContainerPolicyWithoutItem
+    std::optional<privmx::endpoint::core::ContainerPolicy> policy;
+};
+
+/**
+ * ContainerPolicy passed from Java. When it is prepared, its native copy is used without reading its fields.
+ */
+class ContainerPolicyArg {
+public:
+    ContainerPolicyArg(JniContextUtils &ctx, jobject policy);
+
+    ContainerPolicyArg(const ContainerPolicyArg &) = delete;
+
+    ContainerPolicyArg &operator=(const ContainerPolicyArg &) = delete;
+
+    const std::optional<privmx::endpoint::core::ContainerPolicy> &get() const { return *_policy; }
+
+private:
+    std::optional<privmx::endpoint::core::ContainerPolicy> _parsed;
+    const std::optional<privmx::endpoint::core::ContainerPolicy> *_policy;
+};
+
+/**
+ * ContainerPolicyWithoutItem passed from Java. When it is prepared, its native copy is used without reading its fields.
+ */
+class ContainerPolicyWithoutItemArg {
+public:
+    ContainerPolicyWithoutItemArg(JniContextUtils &ctx, jobject policy);
+
+    ContainerPolicyWithoutItemArg(const ContainerPolicyWithoutItemArg &) = delete;
+
+    ContainerPolicyWithoutItemArg &operator=(const ContainerPolicyWithoutItemArg &) = delete;
+
+    const std::optional<privmx::endpoint::core::ContainerPolicyWithoutItem> &get() const { return *_policy; }
+
+private:
+    std::optional<privmx::endpoint::core::ContainerPolicyWithoutItem> _parsed;
+    const std::optional<privmx::endpoint::core::ContainerPolicyWithoutItem> *_policy;
+};
+
+/**
+ * Native copy of sort order and filter created with PreparedQuery.
+ */
+struct PreparedQuery {
+    std::string sortOrder;
+    std::optional<std::string> queryAsJson;
+};
+
+/**
+ * Paging query passed from Java, either as separate arguments or as PreparedQuery with lastId.
+ */
+struct PagingQueryArgs {
+    jlong skip;
+    jlong limit;
+    jstring sortOrder;
+    jstring lastId;
+    jstring queryAsJson;
+    jobject preparedQuery;
+    bool isPrepared;
+
+    static PagingQueryArgs of(jlong skip, jlong limit, jstring sortOrder, jstring lastId,
+                              jstring queryAsJson) {
+        return PagingQueryArgs{skip, limit, sortOrder, lastId, queryAsJson, nullptr, false};
+    }
+
+    static PagingQueryArgs prepared(jlong skip, jlong limit, jobject preparedQuery, jstring lastId) {
+        return PagingQueryArgs{skip, limit, nullptr, lastId, nullptr, preparedQuery, true};
+    }
+
+    /**
+    * Throws NullPointerException in Java when required arguments are missing.
+    */
+    bool nullCheck(JniContextUtils &ctx) const;
+
+    privmx::endpoint::core::PagingQuery toPagingQuery(JniContextUtils &ctx) const;
+};
+
 privmx::endpoint::core::PKIVerificationOptions
 parsePKIVerificationOptions(JniContextUtils &ctx, jobject pkiVerificationOptions);
 
@@ -0,0 +1,178 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "secure.h"
+#include <new>
+#include <utility>
+#include <openssl/crypto.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace privmx {
+    namespace wrapper {
+        namespace {
+            // Locked memory is limited (often to 64 KiB per process), so each thread takes a small block
+            constexpr size_t SECURE_ARENA_SIZE = 4 * 1024;
+            constexpr size_t SECURE_ALIGNMENT = 8;
+
+            size_t pageSize() {
+#ifdef _WIN32
+                SYSTEM_INFO info;
+                GetSystemInfo(&info);
+                return info.dwPageSize;
+#else
+                static const size_t size = (size_t) sysconf(_SC_PAGESIZE);
+                return size;
+#endif
+            }
+        }
+
+        void secureZero(void *ptr, size_t size) {
+            if (ptr != nullptr && size > 0) {
+                OPENSSL_cleanse(ptr, size);
+            }
+        }
+
+        SecureBuffer::SecureBuffer(size_t size) : _size(size) {
+            if (size == 0) {
+                return;
+            }
+            size_t page = pageSize();
+            _mappedSize = (size + page - 1) / page * page;
+#ifdef _WIN32
+            _data = (unsigned char *) VirtualAlloc(nullptr, _mappedSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+            if (_data == nullptr) {
+                throw std::bad_alloc();
+            }
+            _locked = VirtualLock(_data, _mappedSize) != 0;
+#else
+            void *mapped = mmap(nullptr, _mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapped == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            _data = (unsigned char *) mapped;
+            _locked = mlock(_data, _mappedSize) == 0;
+#ifdef MADV_DONTDUMP
+            madvise(_data, _mappedSize, MADV_DONTDUMP);
+#endif
+#endif
+        }
+
+        SecureBuffer::~SecureBuffer() {
+            release();
+        }
+
+        SecureBuffer::SecureBuffer(SecureBuffer &&other) noexcept
+                : _data(std::exchange(other._data, nullptr)),
+                  _size(std::exchange(other._size, 0)),
+                  _mappedSize(std::exchange(other._mappedSize, 0)),
+                  _locked(std::exchange(other._locked, false)) {}
+
+        SecureBuffer &SecureBuffer::operator=(SecureBuffer &&other) noexcept {
+            if (this != &other) {
+                release();
+                _data = std::exchange(other._data, nullptr);
+                _size = std::exchange(other._size, 0);
+                _mappedSize = std::exchange(other._mappedSize, 0);
+                _locked = std::exchange(other._locked, false);
+            }
+            return *this;
+        }
+
+        void SecureBuffer::release() {
+            if (_data == nullptr) {
+                return;
+            }
+            secureZero(_data, _mappedSize);
+#ifdef _WIN32
+            if (_locked) {
+                VirtualUnlock(_data, _mappedSize);
+            }
+            VirtualFree(_data, 0, MEM_RELEASE);
+#else
+            if (_locked) {
+                munlock(_data, _mappedSize);
+            }
+            munmap(_data, _mappedSize);
+#endif
+            _data = nullptr;
+            _size = 0;
+            _mappedSize = 0;
+            _locked = false;
+        }
+
+        SecureArena &SecureArena::current() {
+            static thread_local SecureArena arena;
+            return arena;
+        }
+
+        unsigned char *SecureArena::allocate(size_t size) {
+            if (!_buffer.has_value()) {
+                _buffer.emplace(SECURE_ARENA_SIZE);
+            }
+            size_t aligned = (size + SECURE_ALIGNMENT - 1) & ~(SECURE_ALIGNMENT - 1);
+            if (aligned > _buffer->size() - _offset) {
+                return nullptr;
+            }
+            unsigned char *ptr = _buffer->data() + _offset;
+            _offset += aligned;
+            _live++;
+            return ptr;
+        }
+
+        void SecureArena::release(unsigned char *ptr, size_t size) {
+            size_t aligned = (size + SECURE_ALIGNMENT - 1) & ~(SECURE_ALIGNMENT - 1);
+            secureZero(ptr, aligned);
+            if (ptr + aligned == _buffer->data() + _offset) {
+                _offset -= aligned;
+            }
+            if (--_live == 0) {
+                _offset = 0;
+            }
+        }
+
+        Secret::Secret(size_t size) : _size(size), _allocated(size) {
+            _data = SecureArena::current().allocate(size);
+            if (_data == nullptr) {
+                _own.emplace(size);
+                _data = _own->data();
+            }
+        }
+
+        Secret::Secret(Secret &&other) noexcept
+                : _data(std::exchange(other._data, nullptr)),
+                  _size(std::exchange(other._size, 0)),
+                  _allocated(std::exchange(other._allocated, 0)),
+                  _own(std::move(other._own)) {
+            other._own.reset();
+        }
+
+        Secret::~Secret() {
+            if (_data == nullptr || _own.has_value()) {
+                // SecureBuffer wipes itself
+                return;
+            }
+            SecureArena::current().release(_data, _allocated);
+        }
+
+        void Secret::truncate(size_t size) {
+            if (size < _size) {
+                secureZero(_data + size, _size - size);
+                _size = size;
+            }
+        }
+    } // wrapper
+} // privmx
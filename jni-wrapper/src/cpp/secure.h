@@ -0,0 +1,198 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef PRIVMXENDPOINTWRAPPER_SECURE_H
+#define PRIVMXENDPOINTWRAPPER_SECURE_H
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace privmx {
+    namespace wrapper {
+        /**
+         * Wipes size bytes at ptr in a way the compiler cannot optimize out.
+         */
+        void secureZero(void *ptr, size_t size);
+
+        /**
+         * Fixed-size, page-aligned memory for key material.
+         * Pages are locked in RAM where the platform allows it, so they are never swapped out,
+         * excluded from core dumps on Linux, and wiped before they are released.
+         * When locking fails (e.g. RLIMIT_MEMLOCK is exceeded) the buffer is still usable and wiped,
+         * but locked() returns false.
+         */
+        class SecureBuffer {
+        public:
+            explicit SecureBuffer(size_t size);
+
+            ~SecureBuffer();
+
+            SecureBuffer(SecureBuffer &&other) noexcept;
+
+            SecureBuffer &operator=(SecureBuffer &&other) noexcept;
+
+            SecureBuffer(const SecureBuffer &) = delete;
+
+            SecureBuffer &operator=(const SecureBuffer &) = delete;
+
+            unsigned char *data() { return _data; }
+
+            const unsigned char *data() const { return _data; }
+
+            size_t size() const { return _size; }
+
+            bool locked() const { return _locked; }
+
+        private:
+            void release();
+
+            unsigned char *_data = nullptr;
+            size_t _size = 0;
+            // Size of the mapping, rounded up to whole pages
+            size_t _mappedSize = 0;
+            bool _locked = false;
+        };
+
+        /**
+         * Thread-local bump allocator over a single locked SecureBuffer, for secrets held during a JNI call.
+         * Released bytes are wiped at once; the arena is rewound when all its allocations are released,
+         * so steady state calls neither touch the heap nor lock new pages.
+         */
+        class SecureArena {
+        public:
+            static SecureArena &current();
+
+            /**
+             * Returns size bytes aligned to 8, or nullptr when the arena has no room left.
+             */
+            unsigned char *allocate(size_t size);
+
+            void release(unsigned char *ptr, size_t size);
+
+            SecureArena(const SecureArena &) = delete;
+
+            SecureArena &operator=(const SecureArena &) = delete;
+
+        private:
+            SecureArena() = default;
+
+            std::optional<SecureBuffer> _buffer;
+            size_t _offset = 0;
+            size_t _live = 0;
+        };
+
+        /**
+         * Secret bytes in the current thread's SecureArena, wiped when destroyed.
+         * Secrets larger than the arena's free space get their own SecureBuffer.
+         * Must be destroyed on the thread that created it.
+         */
+        class Secret {
+        public:
+            explicit Secret(size_t size);
+
+            ~Secret();
+
+            Secret(Secret &&other) noexcept;
+
+            Secret(const Secret &) = delete;
+
+            Secret &operator=(const Secret &) = delete;
+
+            Secret &operator=(Secret &&) = delete;
+
+            unsigned char *data() { return _data; }
+
+            const unsigned char *data() const { return _data; }
+
+            size_t size() const { return _size; }
+
+            /**
+             * Shrinks the secret to its first size bytes, wiping the rest.
+             */
+            void truncate(size_t size);
+
+        private:
+            unsigned char *_data;
+            size_t _size;
+            size_t _allocated;
+            std::optional<SecureBuffer> _own;
+        };
+
+        /**
+         * std::string holding a secret for APIs that require std::string, wiped when destroyed.
+         * The string lives on the heap, so it is kept only for the duration of the call it is passed to.
+         */
+        class SecretString {
+        public:
+            SecretString() = default;
+
+            SecretString(const char *data, size_t size) : _value(data, size) {}
+
+            explicit SecretString(std::string &&value) noexcept: _value(std::move(value)) {
+                // The moved-from string may still hold short values in its inline buffer
+                secureZero(&value[0], value.capacity());
+            }
+
+            SecretString(SecretString &&other) noexcept: _value(std::move(other._value)) {
+                other.wipe();
+            }
+
+            SecretString &operator=(SecretString &&other) noexcept {
+                if (this != &other) {
+                    wipe();
+                    _value = std::move(other._value);
+                    other.wipe();
+                }
+                return *this;
+            }
+
+            SecretString(const SecretString &) = delete;
+
+            SecretString &operator=(const SecretString &) = delete;
+
+            ~SecretString() { wipe(); }
+
+            const std::string &str() const { return _value; }
+
+        private:
+            void wipe() {
+                secureZero(&_value[0], _value.capacity());
+                _value.clear();
+            }
+
+            std::string _value;
+        };
+
+        /**
+         * Wipes an optional secret when leaving scope, for APIs taking std::optional<std::string>.
+         */
+        class ScopedWipe {
+        public:
+            explicit ScopedWipe(std::optional<std::string> &value) : _value(value) {}
+
+            ScopedWipe(const ScopedWipe &) = delete;
+
+            ScopedWipe &operator=(const ScopedWipe &) = delete;
+
+            ~ScopedWipe() {
+                if (_value.has_value()) {
+                    secureZero(&(*_value)[0], _value->capacity());
+                }
+            }
+
+        private:
+            std::optional<std::string> &_value;
+        };
+    } // wrapper
+} // privmx
+
+#endif //PRIVMXENDPOINTWRAPPER_SECURE_H
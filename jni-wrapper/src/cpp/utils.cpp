@@ -10,24 +10,251 @@
 //
 
 #include "utils.hpp"
+#include "jniUtils.h"
+#include <cstdint>
+#include <cstring>
 
 void replace_all(std::string &input, const std::string &from, const std::string &to);
 
+namespace {
+    const char *PRIVMX_EXCEPTION_CLASS = "com/simplito/kotlin/privmx_endpoint/model/exceptions/PrivmxException";
+    const char *NATIVE_EXCEPTION_CLASS = "com/simplito/kotlin/privmx_endpoint/model/exceptions/NativeException";
+    const char *CALL_CANCELLED_EXCEPTION_CLASS =
+            "com/simplito/kotlin/privmx_endpoint/model/exceptions/CallCancelledException";
+
+    // Global references shared by all threads, resolved on first use
+    std::atomic<jclass> privmxExceptionCls{nullptr};
+    std::atomic<jmethodID> privmxExceptionInitMID{nullptr};
+    std::atomic<jclass> nativeExceptionCls{nullptr};
+    std::atomic<jclass> illegalStateExceptionCls{nullptr};
+    std::atomic<jclass> nullPointerExceptionCls{nullptr};
+    std::atomic<jclass> callCancelledExceptionCls{nullptr};
+    std::atomic<jclass> completableFutureCls{nullptr};
+    std::atomic<jclass> arrayListCls{nullptr};
+    std::atomic<jmethodID> arrayListInitMID{nullptr};
+    std::atomic<jmethodID> arrayListAddMID{nullptr};
+
+    // Local references reserved for completing a future, the frame grows as needed
+    constexpr jint COMPLETION_LOCAL_REFS = 16;
+
+    // Strings up to this length (in UTF-16 code units) are converted without heap allocation
+    constexpr size_t STACK_STRING_LENGTH = 256;
+
+    // Returns length of the ASCII prefix, testing four UTF-16 code units per step.
+    size_t asciiPrefixLength(const jchar *chars, size_t length) {
+        size_t i = 0;
+        for (; i + 4 <= length; i += 4) {
+            uint64_t block;
+            std::memcpy(&block, chars + i, sizeof(block));
+            if (block & 0xFF80FF80FF80FF80ULL) {
+                break;
+            }
+        }
+        while (i < length && chars[i] < 0x80) {
+            ++i;
+        }
+        return i;
+    }
+
+    // Returns length of the ASCII prefix, testing eight bytes per step.
+    size_t asciiPrefixLength(const char *bytes, size_t length) {
+        size_t i = 0;
+        for (; i + 8 <= length; i += 8) {
+            uint64_t block;
+            std::memcpy(&block, bytes + i, sizeof(block));
+            if (block & 0x8080808080808080ULL) {
+                break;
+            }
+        }
+        while (i < length && (unsigned char) bytes[i] < 0x80) {
+            ++i;
+        }
+        return i;
+    }
+
+    // Each UTF-16 code unit takes at most 3 bytes, a surrogate pair takes 4
+    constexpr size_t MAX_UTF8_PER_UTF16 = 3;
+
+    // Writes UTF-8 form of chars to out, which must hold length * MAX_UTF8_PER_UTF16 bytes.
+    // Returns number of bytes written.
+    size_t utf16ToUtf8(const jchar *chars, size_t length, char *out) {
+        size_t ascii = asciiPrefixLength(chars, length);
+        char *start = out;
+        for (size_t i = 0; i < ascii; ++i) {
+            *out++ = (char) chars[i];
+        }
+        for (size_t i = ascii; i < length;) {
+            uint32_t c = chars[i++];
+            if (c < 0x80) {
+                *out++ = (char) c;
+                continue;
+            }
+            if (c >= 0xD800 && c <= 0xDBFF && i < length && chars[i] >= 0xDC00 && chars[i] <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (chars[i++] - 0xDC00);
+            } else if (c >= 0xD800 && c <= 0xDFFF) {
+                c = 0xFFFD;
+            }
+            if (c < 0x800) {
+                *out++ = (char) (0xC0 | (c >> 6));
+            } else if (c < 0x10000) {
+                *out++ = (char) (0xE0 | (c >> 12));
+                *out++ = (char) (0x80 | ((c >> 6) & 0x3F));
+            } else {
+                *out++ = (char) (0xF0 | (c >> 18));
+                *out++ = (char) (0x80 | ((c >> 12) & 0x3F));
+                *out++ = (char) (0x80 | ((c >> 6) & 0x3F));
+            }
+            *out++ = (char) (0x80 | (c & 0x3F));
+        }
+        return out - start;
+    }
+
+    std::string utf16ToUtf8(const jchar *chars, size_t length) {
+        size_t ascii = asciiPrefixLength(chars, length);
+        if (ascii == length) {
+            std::string result(length, '\0');
+            for (size_t i = 0; i < length; ++i) {
+                result[i] = (char) chars[i];
+            }
+            return result;
+        }
+        std::string result(length * MAX_UTF8_PER_UTF16, '\0');
+        result.resize(utf16ToUtf8(chars, length, &result[0]));
+        return result;
+    }
+
+    // Decodes single UTF-8 sequence starting at bytes[i], advancing i. Returns U+FFFD when invalid.
+    uint32_t decodeUtf8(const unsigned char *bytes, size_t length, size_t &i) {
+        uint32_t c = bytes[i++];
+        size_t extra;
+        uint32_t min;
+        if (c >= 0xC2 && c <= 0xDF) {
+            extra = 1;
+            min = 0x80;
+            c &= 0x1F;
+        } else if (c >= 0xE0 && c <= 0xEF) {
+            extra = 2;
+            min = 0x800;
+            c &= 0x0F;
+        } else if (c >= 0xF0 && c <= 0xF4) {
+            extra = 3;
+            min = 0x10000;
+            c &= 0x07;
+        } else {
+            return 0xFFFD;
+        }
+        if (length - i < extra) {
+            return 0xFFFD;
+        }
+        for (size_t k = 0; k < extra; ++k) {
+            if ((bytes[i + k] & 0xC0) != 0x80) {
+                return 0xFFFD;
+            }
+            c = (c << 6) | (bytes[i + k] & 0x3F);
+        }
+        if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+            return 0xFFFD;
+        }
+        i += extra;
+        return c;
+    }
+
+    // Writes UTF-16 code units of given UTF-8 value to out, which must hold value.size() units.
+    size_t utf8ToUtf16(const std::string &value, jchar *out) {
+        const unsigned char *bytes = (const unsigned char *) value.data();
+        size_t length = value.size();
+        size_t ascii = asciiPrefixLength(value.data(), length);
+        for (size_t i = 0; i < ascii; ++i) {
+            out[i] = bytes[i];
+        }
+        size_t written = ascii;
+        for (size_t i = ascii; i < length;) {
+            if (bytes[i] < 0x80) {
+                out[written++] = bytes[i++];
+                continue;
+            }
+            uint32_t c = decodeUtf8(bytes, length, i);
+            if (c >= 0x10000) {
+                c -= 0x10000;
+                out[written++] = (jchar) (0xD800 + (c >> 10));
+                out[written++] = (jchar) (0xDC00 + (c & 0x3FF));
+            } else {
+                out[written++] = (jchar) c;
+            }
+        }
+        return written;
+    }
+}
+
 std::string JniContextUtils::jString2string(jstring str) {
-    const char *tmp = _env->GetStringUTFChars(str, NULL);
-    std::string result(tmp);
-    _env->ReleaseStringUTFChars(str, tmp);
+    jsize length = _env->GetStringLength(str);
+    if ((size_t) length <= STACK_STRING_LENGTH) {
+        jchar chars[STACK_STRING_LENGTH];
+        _env->GetStringRegion(str, 0, length, chars);
+        return utf16ToUtf8(chars, length);
+    }
+    const jchar *chars = _env->GetStringCritical(str, nullptr);
+    if (chars == nullptr) {
+        // The VM could not expose the characters in place; copy them rather than returning an empty string
+        _env->ExceptionClear();
+        auto &arena = privmx::wrapper::CallArena::current();
+        jchar *copy = arena.allocateArray<jchar>(length);
+        _env->GetStringRegion(str, 0, length, copy);
+        std::string result = utf16ToUtf8(copy, length);
+        arena.deallocate(copy);
+        return result;
+    }
+    std::string result = utf16ToUtf8(chars, length);
+    _env->ReleaseStringCritical(str, chars);
+    return result;
+}
+
+jstring JniContextUtils::string2jString(const std::string &value) {
+    // UTF-8 value never has more UTF-16 code units than bytes
+    if (value.size() <= STACK_STRING_LENGTH) {
+        jchar chars[STACK_STRING_LENGTH];
+        return _env->NewString(chars, (jsize) utf8ToUtf16(value, chars));
+    }
+    auto &arena = privmx::wrapper::CallArena::current();
+    jchar *chars = arena.allocateArray<jchar>(value.size());
+    jstring result = _env->NewString(chars, (jsize) utf8ToUtf16(value, chars));
+    arena.deallocate(chars);
     return result;
 }
 
 std::string JniContextUtils::jByteArray2String(jbyteArray arr) {
     jsize size = _env->GetArrayLength(arr);
-    jbyte *bytes = _env->GetByteArrayElements(arr, NULL);
-    std::string result((const char *) bytes, size);
-    _env->ReleaseByteArrayElements(arr, bytes, JNI_ABORT);
+    std::string result(size, '\0');
+    if (size > 0) {
+        _env->GetByteArrayRegion(arr, 0, size, (jbyte *) &result[0]);
+    }
+    return result;
+}
+
+privmx::wrapper::SecretString JniContextUtils::jString2secret(jstring str) {
+    jsize length = _env->GetStringLength(str);
+    privmx::wrapper::Secret chars(length * sizeof(jchar));
+    _env->GetStringRegion(str, 0, length, (jchar *) chars.data());
+    privmx::wrapper::Secret utf8(length * MAX_UTF8_PER_UTF16);
+    size_t size = utf16ToUtf8((const jchar *) chars.data(), length, (char *) utf8.data());
+    return privmx::wrapper::SecretString((const char *) utf8.data(), size);
+}
+
+privmx::wrapper::Secret JniContextUtils::jByteArray2secret(jbyteArray arr) {
+    jsize size = _env->GetArrayLength(arr);
+    privmx::wrapper::Secret result(size);
+    if (size > 0) {
+        _env->GetByteArrayRegion(arr, 0, size, (jbyte *) result.data());
+    }
     return result;
 }
 
+jstring JniContextUtils::secret2jString(const std::string &value) {
+    // UTF-8 value never has more UTF-16 code units than bytes
+    privmx::wrapper::Secret chars(value.size() * sizeof(jchar));
+    return _env->NewString((const jchar *) chars.data(), (jsize) utf8ToUtf16(value, (jchar *) chars.data()));
+}
+
 jobjectArray JniContextUtils::jObject2jArray(jobject obj) {
     jclass objClass = _env->GetObjectClass(obj);
     if (_env->IsInstanceOf(obj, _env->FindClass("java/util/List"))) {
@@ -38,6 +265,89 @@ jobjectArray JniContextUtils::jObject2jArray(jobject obj) {
     } else return nullptr;
 }
 
+JniContextUtils::StringInterningScope::StringInterningScope(JniContextUtils &ctx)
+        : _ctx(ctx), _previous(ctx._stringInterning) {
+    _ctx._stringInterning = this;
+}
+
+JniContextUtils::StringInterningScope::~StringInterningScope() {
+    _ctx._stringInterning = _previous;
+    for (auto &entry: _strings) {
+        _ctx._env->DeleteGlobalRef(entry.second);
+    }
+}
+
+JniContextUtils::LocalFrame::LocalFrame(JniContextUtils &ctx, jint capacity)
+        : _ctx(ctx), _pushed(false) {
+    if (capacity > 0) {
+        _pushed = ctx._env->PushLocalFrame(capacity) == JNI_OK;
+    }
+}
+
+JniContextUtils::LocalFrame::~LocalFrame() {
+    pop();
+}
+
+jobject JniContextUtils::LocalFrame::pop(jobject result) {
+    if (!_pushed) {
+        return result;
+    }
+    _pushed = false;
+    return _ctx._env->PopLocalFrame(result);
+}
+
+jstring JniContextUtils::internString(const std::string &value) {
+    if (_stringInterning == nullptr) {
+        return string2jString(value);
+    }
+    auto it = _stringInterning->_strings.find(value);
+    if (it != _stringInterning->_strings.end()) {
+        return it->second;
+    }
+    jstring local = string2jString(value);
+    if (local == nullptr || _stringInterning->_strings.size() >= StringInterningScope::MAX_INTERNED_STRINGS) {
+        return local;
+    }
+    auto result = static_cast<jstring>(_env->NewGlobalRef(local));
+    _env->DeleteLocalRef(local);
+    if (result == nullptr) {
+        return nullptr;
+    }
+    char *key = privmx::wrapper::CallArena::current().allocateArray<char>(value.size());
+    std::memcpy(key, value.data(), value.size());
+    _stringInterning->_strings.emplace(StringInterningScope::Key(key, value.size()), result);
+    return result;
+}
+
+jobject JniContextUtils::strings2jList(const std::vector<std::string> &values) {
+    return vector2jList(values, [this](const std::string &value) {
+        return internString(value);
+    });
+}
+
+jobject JniContextUtils::newArrayList(jsize capacity) {
+    jclass listCls = cachedClass(arrayListCls, "java/util/ArrayList");
+    if (listCls == nullptr) {
+        return nullptr;
+    }
+    jmethodID initMID = arrayListInitMID.load(std::memory_order_acquire);
+    if (initMID == nullptr) {
+        initMID = _env->GetMethodID(listCls, "<init>", "(I)V");
+        arrayListInitMID.store(initMID, std::memory_order_release);
+    }
+    return _env->NewObject(listCls, initMID, capacity);
+}
+
+bool JniContextUtils::addToList(jobject list, jobject element) {
+    jmethodID addMID = arrayListAddMID.load(std::memory_order_acquire);
+    if (addMID == nullptr) {
+        addMID = _env->GetMethodID(arrayListCls.load(std::memory_order_acquire), "add", "(Ljava/lang/Object;)Z");
+        arrayListAddMID.store(addMID, std::memory_order_release);
+    }
+    _env->CallBooleanMethod(list, addMID, element);
+    return !_env->ExceptionCheck();
+}
+
 jobject JniContextUtils::long2jLong(long long value) {
     jclass longCls = _env->FindClass("java/lang/Long");
     jmethodID longInitMethodID = _env->GetMethodID(longCls, "<init>", "(J)V");
@@ -62,16 +372,22 @@ JniContextUtils::Object JniContextUtils::getObject(jobject obj) {
 
 jthrowable
 JniContextUtils::coreException2jthrowable(privmx::endpoint::core::Exception exception_c) {
-    jclass exceptionCls = _env->FindClass(
-            "com/simplito/kotlin/privmx_endpoint/model/exceptions/PrivmxException");
-    jmethodID initExceptionMID = _env->GetMethodID(exceptionCls, "<init>",
-                                                   "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;I)V");
+    jclass exceptionCls = cachedClass(privmxExceptionCls, PRIVMX_EXCEPTION_CLASS);
+    if (exceptionCls == nullptr) {
+        return nullptr;
+    }
+    jmethodID initExceptionMID = privmxExceptionInitMID.load(std::memory_order_acquire);
+    if (initExceptionMID == nullptr) {
+        initExceptionMID = _env->GetMethodID(exceptionCls, "<init>",
+                                             "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;I)V");
+        privmxExceptionInitMID.store(initExceptionMID, std::memory_order_release);
+    }
     return (jthrowable) _env->NewObject(
             exceptionCls,
             initExceptionMID,
-            _env->NewStringUTF(exception_c.what()),
-            _env->NewStringUTF(exception_c.getDescription().c_str()),
-            _env->NewStringUTF(exception_c.getScope().c_str()),
+            string2jString(exception_c.what()),
+            string2jString(exception_c.getDescription()),
+            string2jString(exception_c.getScope()),
             (int) exception_c.getCode()
     );
 }
@@ -104,47 +420,80 @@ jboolean JniContextUtils::Object::getBooleanValue() {
 
 bool JniContextUtils::nullCheck(void *value, std::string value_name) {
     if (value == nullptr) {
-        _env->ThrowNew(
-                _env->FindClass("java/lang/NullPointerException"),
-                (value_name + " cannot be null").c_str()
-        );
+        jclass exceptionCls = cachedClass(nullPointerExceptionCls, "java/lang/NullPointerException");
+        if (exceptionCls != nullptr) {
+            _env->ThrowNew(exceptionCls, (value_name + " cannot be null").c_str());
+        }
         return true;
     }
     return false;
 }
 
 jobject JniContextUtils::getKotlinUnit() {
-    jclass unitCls = _env->FindClass("kotlin/Unit");
+    // Kotlin classes come from the application class loader, also on executor threads
+    jclass unitCls = findClass("kotlin/Unit");
     jfieldID unitInstanceFID = _env->GetStaticFieldID(unitCls, "INSTANCE", "Lkotlin/Unit;");
     return _env->GetStaticObjectField(unitCls, unitInstanceFID);
 }
 
-void JniContextUtils::callVoidEndpointApi(const std::function<void()> &fun) {
+void JniContextUtils::throwCurrentException() {
+    jclass exceptionCls;
+    const char *message;
     try {
-        fun();
+        throw;
     } catch (const privmx::endpoint::core::Exception &e) {
-        _env->Throw(coreException2jthrowable(e));
+        jthrowable exception = coreException2jthrowable(e);
+        if (exception != nullptr) {
+            _env->Throw(exception);
+        }
+        return;
+    } catch (const CallCancelledException &e) {
+        exceptionCls = cachedClass(callCancelledExceptionCls, CALL_CANCELLED_EXCEPTION_CLASS);
+        if (exceptionCls == nullptr) {
+            return;
+        }
+        jmethodID initMID = _env->GetMethodID(exceptionCls, "<init>", "(Ljava/lang/String;Z)V");
+        jobject exception = _env->NewObject(
+                exceptionCls,
+                initMID,
+                string2jString(e.what()),
+                (jboolean) e.deadlineExceeded());
+        if (exception != nullptr) {
+            _env->Throw((jthrowable) exception);
+        }
+        return;
     } catch (const IllegalStateException &e) {
-        _env->ThrowNew(
-                _env->FindClass("java/lang/IllegalStateException"),
-                e.what()
-        );
+        exceptionCls = cachedClass(illegalStateExceptionCls, "java/lang/IllegalStateException");
+        message = e.what();
     } catch (const std::exception &e) {
-        _env->ThrowNew(
-                _env->FindClass(
-                        "com/simplito/kotlin/privmx_endpoint/model/exceptions/NativeException"),
-                e.what()
-        );
+        exceptionCls = cachedClass(nativeExceptionCls, NATIVE_EXCEPTION_CLASS);
+        message = e.what();
     } catch (...) {
-        _env->ThrowNew(
-                _env->FindClass(
-                        "com/simplito/kotlin/privmx_endpoint/model/exceptions/NativeException"),
-                "Unknown exception"
-        );
+        exceptionCls = cachedClass(nativeExceptionCls, NATIVE_EXCEPTION_CLASS);
+        message = "Unknown exception";
+    }
+    if (exceptionCls != nullptr) {
+        _env->ThrowNew(exceptionCls, message);
     }
 }
 
-
+jclass JniContextUtils::cachedClass(std::atomic<jclass> &cache, const char *name) {
+    jclass cls = cache.load(std::memory_order_acquire);
+    if (cls != nullptr) {
+        return cls;
+    }
+    jclass localCls = findClass(name);
+    if (localCls == nullptr || _env->ExceptionCheck()) {
+        return nullptr;
+    }
+    jclass globalCls = (jclass) _env->NewGlobalRef(localCls);
+    _env->DeleteLocalRef(localCls);
+    if (!cache.compare_exchange_strong(cls, globalCls, std::memory_order_acq_rel)) {
+        _env->DeleteGlobalRef(globalCls);
+        return cls;
+    }
+    return globalCls;
+}
 
 jclass JniContextUtils::findClass(const char *name) {
     if (jclassLoader == nullptr) {
@@ -158,20 +507,99 @@ jclass JniContextUtils::findClass(const char *name) {
             classLoaderClass,
             "loadClass",
             "(Ljava/lang/String;)Ljava/lang/Class;");
-    return static_cast<jclass>(_env->CallObjectMethod(
+    // Called for every converted model object on executor threads, so temporaries are not left behind
+    jstring jBinaryName = _env->NewStringUTF(binaryName);
+    auto result = static_cast<jclass>(_env->CallObjectMethod(
             jclassLoader,
             gFindClassMethod,
-            _env->NewStringUTF(binaryName)));
+            jBinaryName));
+    _env->DeleteLocalRef(jBinaryName);
+    _env->DeleteLocalRef(classLoaderClass);
+    return result;
 }
 
 void JniContextUtils::setClassLoaderFromObject(jobject object) {
-    auto objectClass = _env->GetObjectClass(object);
-    jclass classClass = _env->GetObjectClass(objectClass);
+    setClassLoaderFromClass(_env->GetObjectClass(object));
+}
+
+void JniContextUtils::setClassLoaderFromClass(jclass cls) {
+    jclass classClass = _env->GetObjectClass(cls);
     auto getClassLoaderMethod = _env->GetMethodID(
             classClass,
             "getClassLoader",
             "()Ljava/lang/ClassLoader;");
-    jclassLoader = _env->CallObjectMethod(objectClass, getClassLoaderMethod);
+    jclassLoader = _env->CallObjectMethod(cls, getClassLoaderMethod);
+}
+
+jobject JniContextUtils::newFuture() {
+    jclass futureCls = cachedClass(completableFutureCls, "java/util/concurrent/CompletableFuture");
+    if (futureCls == nullptr) {
+        return nullptr;
+    }
+    jmethodID initMID = _env->GetMethodID(futureCls, "<init>", "()V");
+    return _env->NewObject(futureCls, initMID);
+}
+
+void JniContextUtils::failFuture(jobject future, std::exception_ptr error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (...) {
+        throwCurrentException();
+    }
+    settleFuture(future, nullptr);
+}
+
+jthrowable JniContextUtils::exception2jthrowable(std::exception_ptr error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (...) {
+        throwCurrentException();
+    }
+    jthrowable exception = _env->ExceptionOccurred();
+    _env->ExceptionClear();
+    return exception;
+}
+
+void JniContextUtils::settleFuture(jobject future, jobject result) {
+    jthrowable exception = _env->ExceptionOccurred();
+    _env->ExceptionClear();
+    jclass futureCls = _env->GetObjectClass(future);
+    if (exception != nullptr) {
+        jmethodID completeExceptionallyMID = _env->GetMethodID(
+                futureCls, "completeExceptionally", "(Ljava/lang/Throwable;)Z");
+        _env->CallBooleanMethod(future, completeExceptionallyMID, exception);
+    } else {
+        jmethodID completeMID = _env->GetMethodID(futureCls, "complete", "(Ljava/lang/Object;)Z");
+        _env->CallBooleanMethod(future, completeMID, result);
+    }
+    // Exceptions thrown by dependent stages running on this thread have nowhere to go
+    _env->ExceptionClear();
+    _env->DeleteLocalRef(futureCls);
+}
+
+void JniContextUtils::completeFuture(JavaVM *javaVM, jobject future, jclass contextClass,
+                                     const std::function<jobject(JniContextUtils &)> &produce) {
+    JNIEnv *env = privmx::wrapper::jni::AttachCurrentThreadIfNeeded(
+            javaVM,
+            privmx::wrapper::jni::getPrivmxExecutorThreadName(),
+            nullptr,
+            true);
+    if (env == nullptr) {
+        return;
+    }
+    JniContextUtils ctx(env);
+    {
+        // Executor threads never return to Java, so local references must be released explicitly
+        LocalFrame frame(ctx, COMPLETION_LOCAL_REFS);
+        ctx.setClassLoaderFromClass(contextClass);
+        jobject result = nullptr;
+        ctx.callResultEndpointApi<jobject>(&result, [&ctx, &produce]() {
+            return produce(ctx);
+        });
+        ctx.settleFuture(future, result);
+    }
+    env->DeleteGlobalRef(future);
+    env->DeleteGlobalRef(contextClass);
 }
 
 void replace_all(std::string &input, const std::string &from, const std::string &to) {
@@ -13,10 +13,22 @@
 #define PRIVMX_PRIVMXPOCKETLIB_UTILS_HPP
 
 #include <string>
+#include <string_view>
 #include <jni.h>
+#include <atomic>
+#include <exception>
 #include <functional>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <iterator>
 #include <privmx/endpoint/core/Exception.hpp>
 #include "exceptions.h"
+#include "arena.h"
+#include "executor.h"
+#include "cancellation.h"
+#include "secure.h"
 
 class JniContextUtils {
 public:
@@ -38,20 +50,112 @@ public:
         JniContextUtils &_env;
     };
 
-    JniContextUtils(JNIEnv *env) : _env(env) {}
+    /**
+    * Enables string interning in given context for the lifetime of the scope.
+    * While the scope is active internString returns the same jstring for equal values,
+    * so fields repeated across list items (IDs, authors, keys) are allocated once.
+    * Interned strings are global references released when the scope ends, so they stay valid
+    * across the local frames of chunked lists; at most MAX_INTERNED_STRINGS are kept.
+    */
+    class StringInterningScope {
+    public:
+        explicit StringInterningScope(JniContextUtils &ctx);
+
+        ~StringInterningScope();
+
+    private:
+        friend class JniContextUtils;
+
+        static constexpr size_t MAX_INTERNED_STRINGS = 4096;
+
+        using Key = std::string_view;
+        using StringMap = std::unordered_map<Key, jstring, std::hash<Key>, std::equal_to<Key>,
+                privmx::wrapper::ArenaAllocator<std::pair<const Key, jstring>>>;
+
+        // Keeps interned keys and table nodes in the call arena until the scope ends
+        privmx::wrapper::CallArena::Scope _arenaScope;
+        JniContextUtils &_ctx;
+        StringInterningScope *_previous;
+        StringMap _strings;
+    };
+
+    /**
+    * Pushes JNI local reference frame for the lifetime of the scope.
+    * Local references created inside the frame are released when the scope ends,
+    * except the one passed to pop.
+    */
+    class LocalFrame {
+    public:
+        LocalFrame(JniContextUtils &ctx, jint capacity);
+
+        ~LocalFrame();
+
+        bool pushed() const { return _pushed; }
+
+        /**
+        * Pops the frame, returning reference to given object valid in the outer frame.
+        */
+        jobject pop(jobject result = nullptr);
+
+    private:
+        JniContextUtils &_ctx;
+        bool _pushed;
+    };
+
+    /**
+    * Number of list items converted within one local reference frame.
+    */
+    static constexpr jsize LIST_CHUNK_SIZE = 64;
+
+    /**
+    * Local references reserved for a single converted list item.
+    */
+    static constexpr jint LIST_REFS_PER_ITEM = 16;
+
+    JniContextUtils(JNIEnv *env) : _env(env), jclassLoader(nullptr), _stringInterning(nullptr) {}
 
     JNIEnv *operator->() { return _env; }
 
+    /**
+    * Converts Java string to UTF-8, including characters outside the BMP.
+    */
     std::string jString2string(jstring str);
 
+    /**
+    * Creates Java string from UTF-8 value. Invalid sequences are replaced with U+FFFD.
+    */
+    jstring string2jString(const std::string &value);
+
     std::string jByteArray2String(jbyteArray arr);
 
+    /**
+    * Converts Java string holding a secret (key, mnemonic, password) to UTF-8.
+    * Intermediate copies are made in locked memory and wiped; the result is wiped when destroyed.
+    */
+    privmx::wrapper::SecretString jString2secret(jstring str);
+
+    /**
+    * Copies Java byte array holding a secret into locked memory, wiped when destroyed.
+    */
+    privmx::wrapper::Secret jByteArray2secret(jbyteArray arr);
+
+    /**
+    * Creates Java string from a secret, converting it in locked memory.
+    */
+    jstring secret2jString(const std::string &value);
+
     jobjectArray jObject2jArray(jobject obj);
 
     Object getObject(jobject obj);
 
     jthrowable coreException2jthrowable(privmx::endpoint::core::Exception exception_c);
 
+    /**
+    * Returns jstring for given value, reusing it when a StringInterningScope is active.
+    * Returned reference must not be deleted by the caller.
+    */
+    jstring internString(const std::string &value);
+
     jobject long2jLong(long long value);
 
     jobject bool2jBoolean(bool value);
@@ -60,35 +164,146 @@ public:
 
     jobject getKotlinUnit();
 
+    /**
+    * Converts items to java.util.ArrayList.
+    * Elements are added directly to a list pre-sized to the number of items, so they are not copied.
+    * Lists longer than LIST_CHUNK_SIZE are converted in chunks, each within its own local frame,
+    * so the number of items is not bounded by the JNI local reference limit.
+    * Returns nullptr when a Java exception is pending.
+    */
+    template<typename Container, typename Converter>
+    jobject vector2jList(Container &items, Converter convert) {
+        jsize size = (jsize) items.size();
+        jobject list = newArrayList(size);
+        if (list == nullptr) {
+            return nullptr;
+        }
+        bool chunked = size > LIST_CHUNK_SIZE;
+        auto it = std::begin(items);
+        auto end = std::end(items);
+        while (it != end) {
+            LocalFrame frame(*this, chunked ? LIST_CHUNK_SIZE * LIST_REFS_PER_ITEM : 0);
+            if (chunked && !frame.pushed()) {
+                return nullptr;
+            }
+            for (jsize i = 0; i < LIST_CHUNK_SIZE && it != end; ++i, ++it) {
+                jobject element = convert(*it);
+                if (_env->ExceptionCheck()) {
+                    return nullptr;
+                }
+                if (!addToList(list, element)) {
+                    return nullptr;
+                }
+            }
+        }
+        return list;
+    }
+
+    /**
+    * Converts strings to java.util.ArrayList, interning them when a StringInterningScope is active.
+    */
+    jobject strings2jList(const std::vector<std::string> &values);
+
     bool nullCheck(void *value, std::string value_name);
 
-    template<typename T>
-    void callResultEndpointApi(T *result, const std::function<T()> &fun) {
+    /**
+    * Calls given function and stores its result.
+    * Exceptions thrown by the function are rethrown in Java.
+    */
+    template<typename T, typename F>
+    void callResultEndpointApi(T *result, F &&fun) {
+        privmx::wrapper::CallArena::Scope arenaScope;
         try {
             *result = fun();
-        } catch (const privmx::endpoint::core::Exception &e) {
-            _env->Throw(coreException2jthrowable(e));
-        } catch (const IllegalStateException &e) {
-            _env->ThrowNew(
-                    _env->FindClass("java/lang/IllegalStateException"),
-                    e.what()
-            );
-        } catch (const std::exception &e) {
-            _env->ThrowNew(
-                    _env->FindClass(
-                            "com/simplito/kotlin/privmx_endpoint/model/exceptions/NativeException"),
-                    e.what()
-            );
         } catch (...) {
-            _env->ThrowNew(
-                    _env->FindClass(
-                            "com/simplito/kotlin/privmx_endpoint/model/exceptions/NativeException"),
-                    "Unknown exception"
-            );
+            throwCurrentException();
+        }
+    }
+
+    /**
+    * Calls given function, rethrowing its exceptions in Java.
+    */
+    template<typename F>
+    void callVoidEndpointApi(F &&fun) {
+        privmx::wrapper::CallArena::Scope arenaScope;
+        try {
+            fun();
+        } catch (...) {
+            throwCurrentException();
+        }
+    }
+
+    /**
+    * Runs given call on the NativeExecutor and returns java.util.concurrent.CompletableFuture
+    * completed with its result converted by convert, or exceptionally with the Java exception
+    * matching the thrown one.
+    * Arguments must be read from Java before, as call runs without JNIEnv and must return a value.
+    * convert runs on an executor thread attached to JVM, using class loader of contextClass.
+    * When token is cancelled or its deadline passes, the future is completed with CallCancelledException
+    * at once; call is skipped if it has not started yet, otherwise its result is dropped.
+    * call runs on given executor, NativeExecutor::instance() by default.
+    * Returns nullptr when a Java exception is pending.
+    */
+    template<typename Call, typename Convert>
+    jobject callAsyncEndpointApi(
+            jclass contextClass,
+            std::shared_ptr<privmx::wrapper::CancellationState> token,
+            Call &&call,
+            Convert &&convert,
+            privmx::wrapper::NativeExecutor &executor = privmx::wrapper::NativeExecutor::instance()
+    ) {
+        jobject future = newFuture();
+        if (future == nullptr) {
+            return nullptr;
         }
+        if (token != nullptr && !token->registerFuture(*this, future)) {
+            failFuture(future, std::make_exception_ptr(CallCancelledException(token->deadlineExceeded())));
+            return future;
+        }
+        JavaVM *javaVM = nullptr;
+        _env->GetJavaVM(&javaVM);
+        jobject futureRef = _env->NewGlobalRef(future);
+        auto contextClassRef = (jclass) _env->NewGlobalRef(contextClass);
+        executor.submit(
+                [javaVM, futureRef, contextClassRef, token,
+                        call = std::forward<Call>(call),
+                        convert = std::forward<Convert>(convert)]() mutable {
+                    std::optional<std::invoke_result_t<Call &>> value;
+                    std::exception_ptr error;
+                    if (token != nullptr && token->isCancelled()) {
+                        error = std::make_exception_ptr(CallCancelledException(token->deadlineExceeded()));
+                    } else {
+                        try {
+                            value.emplace(call());
+                        } catch (...) {
+                            error = std::current_exception();
+                        }
+                    }
+                    completeFuture(javaVM, futureRef, contextClassRef, [&](JniContextUtils &ctx) -> jobject {
+                        if (token != nullptr) {
+                            token->unregisterFuture(ctx, futureRef);
+                            if (!error && token->isCancelled()) {
+                                error = std::make_exception_ptr(CallCancelledException(token->deadlineExceeded()));
+                            }
+                        }
+                        if (error) {
+                            std::rethrow_exception(error);
+                        }
+                        return convert(ctx, *value);
+                    });
+                });
+        return future;
     }
 
-    void callVoidEndpointApi(const std::function<void()> &fun);
+    /**
+    * Completes future exceptionally with the Java exception matching given error.
+    */
+    void failFuture(jobject future, std::exception_ptr error);
+
+    /**
+    * Creates Java exception matching given error, without throwing it.
+    */
+    jthrowable exception2jthrowable(std::exception_ptr error);
 
     /**
     * Returns class for given name.
@@ -100,9 +315,44 @@ public:
 
     void setClassLoaderFromObject(jobject object);
 
+    void setClassLoaderFromClass(jclass cls);
+
+    /**
+    * Returns global reference to class with given name, resolving it on first use.
+    * Returns nullptr (with pending Java exception) when the class cannot be found.
+    */
+    jclass cachedClass(std::atomic<jclass> &cache, const char *name);
+
 private:
     JNIEnv *_env;
     jobject jclassLoader;
+    StringInterningScope *_stringInterning;
+
+    jobject newArrayList(jsize capacity);
+
+    // Returns false when a Java exception is pending
+    bool addToList(jobject list, jobject element);
+
+    jobject newFuture();
+
+    /**
+    * Completes future with the pending Java exception, if any, or with given result.
+    * Clears pending exception.
+    */
+    void settleFuture(jobject future, jobject result);
+
+    /**
+    * Completes future on the current (executor) thread with the object returned by produce,
+    * or exceptionally when produce throws. Releases global references to future and contextClass.
+    */
+    static void completeFuture(JavaVM *javaVM, jobject future, jclass contextClass,
+                               const std::function<jobject(JniContextUtils &)> &produce);
+
+    /**
+    * Throws Java exception matching the exception currently being handled.
+    * Must be called from a catch block.
+    */
+    void throwCurrentException();
 };
 
 #endif //PRIVMX_PRIVMXPOCKETLIB_UTILS_HPP
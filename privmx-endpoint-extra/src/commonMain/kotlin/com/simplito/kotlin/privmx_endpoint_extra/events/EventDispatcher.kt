@@ -121,6 +121,15 @@ class EventDispatcher(
     }
 
 
+    /**
+     * Returns channels that have at least one registered callback.
+     */
+    suspend fun channels(): Set<String> = mapMutex.withLock {
+        map.filterValues { it.isNotEmpty() }
+            .keys
+            .mapTo(mutableSetOf()) { it.substringBefore("_") }
+    }
+
     private suspend fun getCallbacks(type: String): MutableList<Pair> = mapMutex.withLock {
         map.getOrPut(type) { mutableListOf() }
     }
@@ -24,9 +24,12 @@ import kotlinx.coroutines.IO
 import kotlinx.coroutines.async
 import kotlinx.coroutines.cancel
 import kotlinx.coroutines.isActive
+import kotlinx.coroutines.sync.Semaphore
+import kotlinx.coroutines.sync.withPermit
 import kotlinx.coroutines.withContext
 import kotlinx.io.IOException
 import kotlinx.io.Source
+import kotlin.concurrent.atomics.AtomicBoolean
 import kotlin.concurrent.atomics.AtomicReference
 import kotlin.concurrent.atomics.ExperimentalAtomicApi
 import kotlin.coroutines.CoroutineContext
@@ -60,30 +63,41 @@ class InboxEntryStream private constructor(
     )
 
     /**
-     * Initiates the process of sending files using the provided executor.
+     * Initiates the process of sending files in the given coroutine context.
      *
-     * This method submits each file for sending to the `fileStreamExecutor`
-     * and wait for completion.
+     * Files are uploaded concurrently, each through its own file handle, with at most
+     * [maxParallelFiles] files being sent at once. Progress of each file is reported separately
+     * to [EntryStreamListener.onFileChunkProcessed].
      *
-     * @param fileStreamExecutor the executor service responsible for executing file sending tasks
+     * @param coroutineContext context in which files are sent
+     * @param maxParallelFiles maximum number of files sent at once
      * @throws IllegalStateException If the stream is not in the [State.PREPARED] state
      */
     @Throws(IllegalStateException::class)
     @JvmOverloads
     fun sendFiles(
-        coroutineContext: CoroutineContext = sendingFilesContext
+        coroutineContext: CoroutineContext = sendingFilesContext,
+        maxParallelFiles: Int = DEFAULT_MAX_PARALLEL_FILES
     ): Deferred<Unit> {
+        require(maxParallelFiles > 0) { "maxParallelFiles should be greater than 0" }
         check(streamState.load() == State.PREPARED) { "Stream should be in state PREPARED. Current state is: " + streamState.load().name }
         return coroutineScope.async(coroutineContext) sendingFileAsync@{
             check(!::sendingFiles.isInitialized) { "Files are being sent" }
+            val sendingPermits = Semaphore(maxParallelFiles)
+            val failed = AtomicBoolean(false)
             sendingFiles = inboxFiles.map { (fileInfo, fileHandle) ->
                 async {
-                    try {
-                        sendFile(fileInfo, fileHandle)
-                        entryStreamListener.onEndFileSending(fileInfo)
-                    } catch (e: Exception) {
-                        onError(e)
-                        entryStreamListener.onErrorDuringSending(fileInfo, e)
+                    sendingPermits.withPermit {
+                        try {
+                            sendFile(fileInfo, fileHandle)
+                            entryStreamListener.onEndFileSending(fileInfo)
+                        } catch (e: CancellationException) {
+                            throw e
+                        } catch (e: Exception) {
+                            failed.store(true)
+                            onError(e)
+                            entryStreamListener.onErrorDuringSending(fileInfo, e)
+                        }
                     }
                 }
             }
@@ -97,7 +111,7 @@ class InboxEntryStream private constructor(
                 }
             }
 
-            if (sendingFiles.all { it.isCompleted }) {
+            if (!failed.load()) {
                 updateState(State.FILES_SENT)
             } else {
                 onError(IllegalStateException("Some files cannot be sent"))
@@ -127,15 +141,14 @@ class InboxEntryStream private constructor(
         entryStreamListener.onStartFileSending(fileInfo)
         if (fileInfo.fileStream == null) {
             fileHandle.setProgressListener(controller)
-            while (fileInfo.fileSize > fileHandle.processedBytes && !fileHandle.isClosed) {
-                if (controller.isStopped) {
-                    break
-                }
+            var sentBytes = 0L
+            while (sentBytes < fileInfo.fileSize && !controller.isStopped) {
                 val nextChunk = entryStreamListener.onNextChunkRequest(fileInfo)
                     ?: throw NullPointerException("Data chunk cannot be null")
                 withContext(sendingChunkContext) {
                     fileHandle.write(inboxHandle, nextChunk)
                 }
+                sentBytes += nextChunk.size
             }
         } else {
             withContext(sendingChunkContext) {
@@ -179,7 +192,7 @@ class InboxEntryStream private constructor(
     }
 
     private fun stopFileStreams() {
-        if (streamState.load() == State.PREPARED) {
+        if (streamState.load() == State.PREPARED && ::sendingFiles.isInitialized) {
             sendingFiles.forEach { it.cancel() }
         }
     }
@@ -364,6 +377,10 @@ class InboxEntryStream private constructor(
     }
 
     companion object {
+        /**
+         * Default maximum number of files sent at once by [sendFiles].
+         */
+        const val DEFAULT_MAX_PARALLEL_FILES: Int = 4
 
         /**
          * Creates an [InboxEntryStream] instance ready for streaming, with optional files and encryption.
@@ -19,6 +19,13 @@ import com.simplito.kotlin.privmx_endpoint_extra.events.EventCallback
 import com.simplito.kotlin.privmx_endpoint_extra.events.EventDispatcher
 import com.simplito.kotlin.privmx_endpoint_extra.events.EventType
 import com.simplito.kotlin.privmx_endpoint_extra.model.Modules
+import kotlinx.coroutines.CoroutineName
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.IO
+import kotlinx.coroutines.SupervisorJob
+import kotlinx.coroutines.cancel
+import kotlinx.coroutines.launch
 import kotlin.jvm.JvmOverloads
 
 /**
@@ -57,6 +64,9 @@ constructor(
         }
     }
     private val eventDispatcher: EventDispatcher = EventDispatcher(onRemoveChannel)
+    private var resubscribeOnConnect = false
+    private val resubscribeScope =
+        CoroutineScope(SupervisorJob() + Dispatchers.IO + CoroutineName("PrivMX resubscribe"))
 
     /**
      * Registers callbacks with the specified type.
@@ -100,13 +110,76 @@ constructor(
 
     /**
      * Handles event and invokes all related callbacks. It should only be called by event loops.
+     * When the connection to the platform is restored, all channels with registered callbacks
+     * are subscribed again in the background, without blocking the event loop,
+     * and the [EventType.ConnectedEvent] callbacks are invoked once it finishes.
      *
      * @param event event to handle
      */
     suspend fun handleEvent(event: Event<out Any>) {
+        if (event.type == PLATFORM_DISCONNECTED_EVENT_TYPE) {
+            resubscribeOnConnect = true
+        } else if (event.type == EventType.ConnectedEvent.eventType && resubscribeOnConnect) {
+            resubscribeOnConnect = false
+            val channels = eventDispatcher.channels()
+            resubscribeScope.launch {
+                resubscribeChannels(channels)
+                eventDispatcher.emit(event)
+            }
+            return
+        }
         eventDispatcher.emit(event)
     }
 
+    /**
+     * Cancels pending channel resubscription and closes the connection.
+     */
+    override fun close() {
+        resubscribeScope.cancel()
+        super.close()
+    }
+
+    /**
+     * Subscribes given channels again, subscribing Thread, Store and Inbox channels
+     * with one bulk call per module.
+     */
+    private fun resubscribeChannels(channels: Set<String>) {
+        val threadIds = mutableListOf<String>()
+        val storeIds = mutableListOf<String>()
+        val inboxIds = mutableListOf<String>()
+        for (channelStr in channels) {
+            val channel = Channel.fromString(channelStr) ?: continue
+            val instanceId = channel.instanceId?.takeIf { it.isNotEmpty() }
+            when {
+                instanceId != null && channel.module.startsWith("thread") && channel.type == "messages" ->
+                    threadIds.add(instanceId)
+
+                instanceId != null && channel.module.startsWith("store") && channel.type == "files" ->
+                    storeIds.add(instanceId)
+
+                instanceId != null && channel.module.startsWith("inbox") && channel.type == "entries" ->
+                    inboxIds.add(instanceId)
+
+                else -> try {
+                    subscribeChannel(channelStr)
+                } catch (e: Exception) {
+                    println("Cannot resubscribe channel $channelStr (detail message: ${e.message})")
+                }
+            }
+        }
+        val failures = mutableMapOf<String, Throwable>()
+        try {
+            if (threadIds.isNotEmpty()) threadApi?.subscribeForMessageEvents(threadIds)?.let(failures::putAll)
+            if (storeIds.isNotEmpty()) storeApi?.subscribeForFileEvents(storeIds)?.let(failures::putAll)
+            if (inboxIds.isNotEmpty()) inboxApi?.subscribeForEntryEvents(inboxIds)?.let(failures::putAll)
+        } catch (e: Exception) {
+            println("Cannot resubscribe channels (detail message: ${e.message})")
+        }
+        failures.forEach { (id, e) ->
+            println("Cannot resubscribe channel of $id (detail message: ${e.message})")
+        }
+    }
+
     private fun subscribeChannel(channelStr: String) {
         val channel = Channel.fromString(channelStr)
         if (channel == null) {
@@ -217,6 +290,10 @@ constructor(
         }
     }
 
+    private companion object {
+        const val PLATFORM_DISCONNECTED_EVENT_TYPE = "libPlatformDisconnected"
+    }
+
     private class Channel(
         val module: String,
         val instanceId: String?,
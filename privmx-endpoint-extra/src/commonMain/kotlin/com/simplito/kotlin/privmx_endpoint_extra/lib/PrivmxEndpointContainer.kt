@@ -194,9 +194,6 @@ class PrivmxEndpointContainer() : AutoCloseable {
 
 
     private suspend fun onNewEvent(event: Event<out Any>) {
-        if (event.type.equals("libPlatformDisconnected")) {
-            return
-        }
         if (event.connectionId != null && event.connectionId != -1L) {
             connectionsMutex.withLock {
                 privmxEndpoints[event.connectionId]?.let { endpoint ->
@@ -0,0 +1,125 @@
+//
+// PrivMX Endpoint Kotlin Extra.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint_extra.async
+
+import com.simplito.kotlin.privmx_endpoint.model.Message
+import com.simplito.kotlin.privmx_endpoint.model.PKIVerificationOptions
+import com.simplito.kotlin.privmx_endpoint.model.PagingList
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.PrivmxException
+import com.simplito.kotlin.privmx_endpoint.modules.core.CancellationToken
+import com.simplito.kotlin.privmx_endpoint.modules.core.Connection
+import com.simplito.kotlin.privmx_endpoint.modules.store.StoreApi
+import com.simplito.kotlin.privmx_endpoint.modules.thread.ThreadApi
+import kotlinx.coroutines.future.await
+import java.util.concurrent.CompletableFuture
+import kotlin.coroutines.cancellation.CancellationException
+
+// Suspending versions of endpoint calls that run on the native thread pool.
+// A suspended coroutine does not occupy any JVM thread while the request is in progress.
+// Cancelling the coroutine (including withTimeout) cancels the call: a call which has not started
+// yet is skipped, a request already sent finishes in the background and its result is dropped.
+
+private suspend inline fun <T> awaitCancellable(call: (CancellationToken) -> CompletableFuture<T>): T {
+    val token = CancellationToken.create()
+    try {
+        return call(token).await()
+    } catch (e: CancellationException) {
+        token.cancel()
+        throw e
+    } finally {
+        token.close()
+    }
+}
+
+/**
+ * Connects to PrivMX Bridge server, suspending until the connection is established.
+ *
+ * @param userPrivKey         user's private key
+ * @param solutionId          ID of the Solution
+ * @param bridgeUrl           PrivMX Bridge server URL
+ * @param verificationOptions PrivMX Bridge server instance verification options using a PKI server
+ * @return Connection object
+ * @throws PrivmxException thrown when method encounters an exception
+ * @throws NativeException thrown when method encounters an unknown exception
+ */
+@Throws(PrivmxException::class, NativeException::class)
+suspend fun Connection.Companion.awaitConnect(
+    userPrivKey: String,
+    solutionId: String,
+    bridgeUrl: String,
+    verificationOptions: PKIVerificationOptions? = null
+): Connection = awaitCancellable { token ->
+    connectAsync(userPrivKey, solutionId, bridgeUrl, verificationOptions, token)
+}
+
+/**
+ * Sends a message in a Thread, suspending until it is sent.
+ *
+ * @param threadId    ID of the Thread to send message to
+ * @param publicMeta  public message metadata
+ * @param privateMeta private message metadata
+ * @param data        content of the message
+ * @return ID of the new message
+ * @throws IllegalStateException thrown when instance is closed
+ * @throws PrivmxException       thrown when method encounters an exception
+ * @throws NativeException       thrown when method encounters an unknown exception
+ */
+@Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+suspend fun ThreadApi.awaitSendMessage(
+    threadId: String,
+    publicMeta: ByteArray,
+    privateMeta: ByteArray,
+    data: ByteArray
+): String = awaitCancellable { token ->
+    sendMessageAsync(threadId, publicMeta, privateMeta, data, token)
+}
+
+/**
+ * Gets a list of messages from a Thread, suspending until it is received.
+ *
+ * @param threadId    ID of the Thread to list messages from
+ * @param skip        skip number of elements to skip from result
+ * @param limit       limit of elements to return for query
+ * @param sortOrder   order of elements in result ("asc" for ascending, "desc" for descending)
+ * @param lastId      ID of the element from which query results should start
+ * @param queryAsJson stringified JSON object with a custom field to filter result
+ * @return list of messages
+ * @throws IllegalStateException thrown when instance is closed
+ * @throws PrivmxException       thrown when method encounters an exception
+ * @throws NativeException       thrown when method encounters an unknown exception
+ */
+@Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+suspend fun ThreadApi.awaitListMessages(
+    threadId: String,
+    skip: Long,
+    limit: Long,
+    sortOrder: String = "desc",
+    lastId: String? = null,
+    queryAsJson: String? = null
+): PagingList<Message> = awaitCancellable { token ->
+    listMessagesAsync(threadId, skip, limit, sortOrder, lastId, queryAsJson, token)
+}
+
+/**
+ * Reads file data, suspending until the chunk is received.
+ *
+ * @param fileHandle handle to read file data
+ * @param length     size of data to read
+ * @return File data chunk
+ * @throws IllegalStateException thrown when instance is closed
+ * @throws PrivmxException       thrown when method encounters an exception
+ * @throws NativeException       thrown when method encounters an unknown exception
+ */
+@Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+suspend fun StoreApi.awaitReadFromFile(fileHandle: Long, length: Long): ByteArray =
+    awaitCancellable { token -> readFromFileAsync(fileHandle, length, token) }
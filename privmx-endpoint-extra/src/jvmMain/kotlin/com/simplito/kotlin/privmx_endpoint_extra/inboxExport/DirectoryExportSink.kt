@@ -0,0 +1,46 @@
+//
+// PrivMX Endpoint Kotlin Extra.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint_extra.inboxExport
+
+import com.simplito.kotlin.privmx_endpoint.model.File
+import com.simplito.kotlin.privmx_endpoint.model.InboxEntry
+import java.io.BufferedOutputStream
+import java.io.OutputStream
+import java.nio.file.Files
+import java.nio.file.Path
+
+/**
+ * Stores exported entries in a directory.
+ *
+ * Each entry is stored in a subdirectory named by its ID, containing entry data in `data`
+ * and its files in `files/<fileId>`.
+ *
+ * @param directory directory to store entries in; it is created when it does not exist
+ */
+class DirectoryExportSink(private val directory: Path) : InboxExportSink {
+    override fun onEntry(entry: InboxEntry) {
+        val entryDirectory = directory.resolve(entry.entryId)
+        Files.createDirectories(entryDirectory.resolve(FILES_DIRECTORY))
+        Files.write(entryDirectory.resolve(DATA_FILE), entry.data)
+    }
+
+    override fun openFile(entry: InboxEntry, fileIndex: Int, file: File): OutputStream =
+        BufferedOutputStream(
+            Files.newOutputStream(
+                directory.resolve(entry.entryId).resolve(FILES_DIRECTORY).resolve(file.info.fileId)
+            )
+        )
+
+    private companion object {
+        const val DATA_FILE = "data"
+        const val FILES_DIRECTORY = "files"
+    }
+}
@@ -0,0 +1,156 @@
+//
+// PrivMX Endpoint Kotlin Extra.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint_extra.inboxExport
+
+import com.simplito.kotlin.privmx_endpoint.model.InboxEntry
+import com.simplito.kotlin.privmx_endpoint.modules.inbox.InboxApi
+import com.simplito.kotlin.privmx_endpoint_extra.inboxFileStream.InboxFileStream
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.sync.Semaphore
+import kotlinx.coroutines.sync.withPermit
+import kotlinx.coroutines.withContext
+import java.io.OutputStream
+import java.util.concurrent.ConcurrentHashMap
+import kotlin.coroutines.cancellation.CancellationException
+
+/**
+ * Exports Inbox entries together with their files.
+ *
+ * Entries are read in batches with [InboxApi.readEntries]. Their files are downloaded concurrently,
+ * at most `maxParallelDownloads` at once, while next batches of entries are being read.
+ */
+object InboxEntryExporter {
+    /**
+     * Default maximum number of files downloaded at once.
+     */
+    const val DEFAULT_MAX_PARALLEL_DOWNLOADS: Int = 4
+
+    /**
+     * Number of entries read within a single [InboxApi.readEntries] call.
+     */
+    const val READ_BATCH_SIZE: Int = 100
+
+    /**
+     * Exports entries with given IDs and their files to [sink].
+     * Failure of one entry does not stop exporting the others.
+     *
+     * @param inboxApi             reference to Inbox API
+     * @param entryIds             IDs of entries to export
+     * @param sink                 receiver of exported entries and files
+     * @param maxParallelDownloads maximum number of files downloaded at once
+     * @return map from IDs of entries that could not be exported to the exceptions thrown for them
+     */
+    suspend fun export(
+        inboxApi: InboxApi,
+        entryIds: List<String>,
+        sink: InboxExportSink,
+        maxParallelDownloads: Int = DEFAULT_MAX_PARALLEL_DOWNLOADS
+    ): Map<String, Throwable> = withContext(Dispatchers.IO) {
+        require(maxParallelDownloads > 0) { "maxParallelDownloads should be greater than 0" }
+        val failures = ConcurrentHashMap<String, Throwable>()
+        val downloadPermits = Semaphore(maxParallelDownloads)
+        // Keeps reading at most one batch ahead of entries being exported
+        val entryPermits = Semaphore(READ_BATCH_SIZE)
+        coroutineScope {
+            for (batch in entryIds.distinct().chunked(READ_BATCH_SIZE)) {
+                for (entry in readBatch(inboxApi, batch, failures)) {
+                    entryPermits.acquire()
+                    launch {
+                        try {
+                            exportEntry(inboxApi, entry, sink, downloadPermits)
+                        } catch (e: CancellationException) {
+                            throw e
+                        } catch (e: Exception) {
+                            failures[entry.entryId] = e
+                        } finally {
+                            entryPermits.release()
+                        }
+                    }
+                }
+            }
+        }
+        failures
+    }
+
+    /**
+     * Exports entries with given IDs and their files to [sink], blocking the calling thread until done.
+     *
+     * @param inboxApi             reference to Inbox API
+     * @param entryIds             IDs of entries to export
+     * @param sink                 receiver of exported entries and files
+     * @param maxParallelDownloads maximum number of files downloaded at once
+     * @return map from IDs of entries that could not be exported to the exceptions thrown for them
+     */
+    @JvmStatic
+    @JvmOverloads
+    fun exportBlocking(
+        inboxApi: InboxApi,
+        entryIds: List<String>,
+        sink: InboxExportSink,
+        maxParallelDownloads: Int = DEFAULT_MAX_PARALLEL_DOWNLOADS
+    ): Map<String, Throwable> = runBlocking {
+        export(inboxApi, entryIds, sink, maxParallelDownloads)
+    }
+
+    private fun readBatch(
+        inboxApi: InboxApi,
+        entryIds: List<String>,
+        failures: MutableMap<String, Throwable>
+    ): List<InboxEntry> = try {
+        inboxApi.readEntries(entryIds)
+    } catch (_: Exception) {
+        // Read entries one by one to find out which of them failed
+        entryIds.mapNotNull { entryId ->
+            try {
+                inboxApi.readEntry(entryId)
+            } catch (e: Exception) {
+                failures[entryId] = e
+                null
+            }
+        }
+    }
+
+    private suspend fun exportEntry(
+        inboxApi: InboxApi,
+        entry: InboxEntry,
+        sink: InboxExportSink,
+        downloadPermits: Semaphore
+    ) = coroutineScope {
+        sink.onEntry(entry)
+        entry.files.mapIndexed { index, file ->
+            async {
+                downloadPermits.withPermit {
+                    sink.openFile(entry, index, file).use { output ->
+                        downloadFile(inboxApi, file.info.fileId, output)
+                    }
+                }
+            }
+        }.awaitAll()
+        sink.onEntryExported(entry)
+    }
+
+    private fun downloadFile(inboxApi: InboxApi, fileId: String, output: OutputStream) {
+        val fileHandle = inboxApi.openFile(fileId)!!
+        try {
+            do {
+                val chunk = inboxApi.readFromFile(fileHandle, InboxFileStream.OPTIMAL_SEND_SIZE)
+                output.write(chunk)
+            } while (chunk.size.toLong() == InboxFileStream.OPTIMAL_SEND_SIZE)
+        } finally {
+            inboxApi.closeFile(fileHandle)
+        }
+    }
+}
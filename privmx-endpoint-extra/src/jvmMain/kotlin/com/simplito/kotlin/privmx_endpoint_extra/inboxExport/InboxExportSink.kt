@@ -0,0 +1,52 @@
+//
+// PrivMX Endpoint Kotlin Extra.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint_extra.inboxExport
+
+import com.simplito.kotlin.privmx_endpoint.model.File
+import com.simplito.kotlin.privmx_endpoint.model.InboxEntry
+import java.io.IOException
+import java.io.OutputStream
+
+/**
+ * Receives entries and their files downloaded by [InboxEntryExporter].
+ *
+ * Methods are called concurrently for different entries and files, so implementations must be thread-safe.
+ */
+interface InboxExportSink {
+    /**
+     * Called once for each entry, before any of its files is downloaded.
+     *
+     * @param entry exported entry
+     * @throws IOException when the entry cannot be stored
+     */
+    @Throws(IOException::class)
+    fun onEntry(entry: InboxEntry)
+
+    /**
+     * Opens stream for content of given entry file. The stream is closed by the exporter.
+     *
+     * @param entry     entry the file is attached to
+     * @param fileIndex position of the file in [InboxEntry.files]
+     * @param file      exported file
+     * @return stream to write file content to
+     * @throws IOException when the stream cannot be opened
+     */
+    @Throws(IOException::class)
+    fun openFile(entry: InboxEntry, fileIndex: Int, file: File): OutputStream
+
+    /**
+     * Called when given entry and all of its files were exported.
+     *
+     * @param entry exported entry
+     */
+    fun onEntryExported(entry: InboxEntry) {
+    }
+}
@@ -21,7 +21,7 @@ package com.simplito.kotlin.privmx_endpoint.model
  * @param ownerCanBeRemovedFromManagers   Determines whether the owner can be removed from the list of managers
  * @property item                            Policy for container's items
  */
-class ContainerPolicy(
+open class ContainerPolicy(
     get: String?,
     update: String?,
     delete: String?,
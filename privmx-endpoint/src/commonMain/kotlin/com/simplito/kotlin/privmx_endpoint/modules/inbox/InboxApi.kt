@@ -397,6 +397,17 @@ constructor(
     )
     fun subscribeForEntryEvents(inboxId: String)
 
+    /**
+     * Subscribes for events in each of given Inboxes.
+     * Failure for one Inbox does not stop the others.
+     *
+     * @param inboxIds IDs of the Inboxes to subscribe; duplicated IDs are subscribed once
+     * @return map from IDs of Inboxes that could not be subscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    fun subscribeForEntryEvents(inboxIds: List<String>): Map<String, Throwable>
+
     /**
      * Unsubscribes from events in given Inbox.
      *
@@ -410,6 +421,17 @@ constructor(
     )
     fun unsubscribeFromEntryEvents(inboxId: String)
 
+    /**
+     * Unsubscribes from events in each of given Inboxes.
+     * Failure for one Inbox does not stop the others.
+     *
+     * @param inboxIds IDs of the Inboxes to unsubscribe; duplicated IDs are unsubscribed once
+     * @return map from IDs of Inboxes that could not be unsubscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    fun unsubscribeFromEntryEvents(inboxIds: List<String>): Map<String, Throwable>
+
     /**
      * Frees memory.
      *
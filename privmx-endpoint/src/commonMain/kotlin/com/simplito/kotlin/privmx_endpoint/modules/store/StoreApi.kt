@@ -394,6 +394,17 @@ constructor(connection: Connection) : AutoCloseable {
     )
     fun subscribeForFileEvents(storeId: String)
 
+    /**
+     * Subscribes for events in each of given Stores.
+     * Failure for one Store does not stop the others.
+     *
+     * @param storeIds IDs of the Stores to subscribe; duplicated IDs are subscribed once
+     * @return map from IDs of Stores that could not be subscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    fun subscribeForFileEvents(storeIds: List<String>): Map<String, Throwable>
+
     /**
      * Unsubscribes from events in given Store.
      *
@@ -409,6 +420,17 @@ constructor(connection: Connection) : AutoCloseable {
     )
     fun unsubscribeFromFileEvents(storeId: String)
 
+    /**
+     * Unsubscribes from events in each of given Stores.
+     * Failure for one Store does not stop the others.
+     *
+     * @param storeIds IDs of the Stores to unsubscribe; duplicated IDs are unsubscribed once
+     * @return map from IDs of Stores that could not be unsubscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    fun unsubscribeFromFileEvents(storeIds: List<String>): Map<String, Throwable>
+
     /**
      * Frees memory.
      *
@@ -247,6 +247,17 @@ constructor(connection: Connection) : AutoCloseable {
     @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
     fun subscribeForMessageEvents(threadId: String)
 
+    /**
+     * Subscribes for events in each of given Threads.
+     * Failure for one Thread does not stop the others.
+     *
+     * @param threadIds IDs of the Threads to subscribe; duplicated IDs are subscribed once
+     * @return map from IDs of Threads that could not be subscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    fun subscribeForMessageEvents(threadIds: List<String>): Map<String, Throwable>
+
     /**
      * Unsubscribes from events in given Thread.
      *
@@ -258,6 +269,17 @@ constructor(connection: Connection) : AutoCloseable {
     @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
     fun unsubscribeFromMessageEvents(threadId: String)
 
+    /**
+     * Unsubscribes from events in each of given Threads.
+     * Failure for one Thread does not stop the others.
+     *
+     * @param threadIds IDs of the Threads to unsubscribe; duplicated IDs are unsubscribed once
+     * @return map from IDs of Threads that could not be unsubscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    fun unsubscribeFromMessageEvents(threadIds: List<String>): Map<String, Throwable>
+
     /**
      * Frees memory.
      *
@@ -724,6 +724,27 @@ actual constructor(
         }
     }
 
+    /**
+     * Subscribes for events in each of given Inboxes.
+     * Failure for one Inbox does not stop the others.
+     *
+     * @param inboxIds IDs of the Inboxes to subscribe; duplicated IDs are subscribed once
+     * @return map from IDs of Inboxes that could not be subscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun subscribeForEntryEvents(inboxIds: List<String>): Map<String, Throwable> =
+        inboxIds.distinct().mapNotNull { inboxId ->
+            try {
+                subscribeForEntryEvents(inboxId)
+                null
+            } catch (e: PrivmxException) {
+                inboxId to e
+            } catch (e: NativeException) {
+                inboxId to e
+            }
+        }.toMap()
+
     /**
      * Unsubscribes from events in given Inbox.
      *
@@ -748,6 +769,27 @@ actual constructor(
         }
     }
 
+    /**
+     * Unsubscribes from events in each of given Inboxes.
+     * Failure for one Inbox does not stop the others.
+     *
+     * @param inboxIds IDs of the Inboxes to unsubscribe; duplicated IDs are unsubscribed once
+     * @return map from IDs of Inboxes that could not be unsubscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun unsubscribeFromEntryEvents(inboxIds: List<String>): Map<String, Throwable> =
+        inboxIds.distinct().mapNotNull { inboxId ->
+            try {
+                unsubscribeFromEntryEvents(inboxId)
+                null
+            } catch (e: PrivmxException) {
+                inboxId to e
+            } catch (e: NativeException) {
+                inboxId to e
+            }
+        }.toMap()
+
     /**
      * Frees memory.
      *
@@ -715,6 +715,27 @@ actual constructor(connection: Connection) :
         }
     }
 
+    /**
+     * Subscribes for events in each of given Stores.
+     * Failure for one Store does not stop the others.
+     *
+     * @param storeIds IDs of the Stores to subscribe; duplicated IDs are subscribed once
+     * @return map from IDs of Stores that could not be subscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun subscribeForFileEvents(storeIds: List<String>): Map<String, Throwable> =
+        storeIds.distinct().mapNotNull { storeId ->
+            try {
+                subscribeForFileEvents(storeId)
+                null
+            } catch (e: PrivmxException) {
+                storeId to e
+            } catch (e: NativeException) {
+                storeId to e
+            }
+        }.toMap()
+
     /**
      * Unsubscribes from events in given Store.
      *
@@ -743,6 +764,27 @@ actual constructor(connection: Connection) :
         }
     }
 
+    /**
+     * Unsubscribes from events in each of given Stores.
+     * Failure for one Store does not stop the others.
+     *
+     * @param storeIds IDs of the Stores to unsubscribe; duplicated IDs are unsubscribed once
+     * @return map from IDs of Stores that could not be unsubscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun unsubscribeFromFileEvents(storeIds: List<String>): Map<String, Throwable> =
+        storeIds.distinct().mapNotNull { storeId ->
+            try {
+                unsubscribeFromFileEvents(storeId)
+                null
+            } catch (e: PrivmxException) {
+                storeId to e
+            } catch (e: NativeException) {
+                storeId to e
+            }
+        }.toMap()
+
     /**
      * Frees memory.
      *
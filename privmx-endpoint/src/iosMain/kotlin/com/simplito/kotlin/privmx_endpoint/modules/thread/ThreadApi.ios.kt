@@ -484,6 +484,27 @@ actual constructor(connection: Connection) : AutoCloseable {
         }
     }
 
+    /**
+     * Subscribes for events in each of given Threads.
+     * Failure for one Thread does not stop the others.
+     *
+     * @param threadIds IDs of the Threads to subscribe; duplicated IDs are subscribed once
+     * @return map from IDs of Threads that could not be subscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun subscribeForMessageEvents(threadIds: List<String>): Map<String, Throwable> =
+        threadIds.distinct().mapNotNull { threadId ->
+            try {
+                subscribeForMessageEvents(threadId)
+                null
+            } catch (e: PrivmxException) {
+                threadId to e
+            } catch (e: NativeException) {
+                threadId to e
+            }
+        }.toMap()
+
     /**
      * Unsubscribes from events in given Thread.
      *
@@ -506,6 +527,27 @@ actual constructor(connection: Connection) : AutoCloseable {
         }
     }
 
+    /**
+     * Unsubscribes from events in each of given Threads.
+     * Failure for one Thread does not stop the others.
+     *
+     * @param threadIds IDs of the Threads to unsubscribe; duplicated IDs are unsubscribed once
+     * @return map from IDs of Threads that could not be unsubscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun unsubscribeFromMessageEvents(threadIds: List<String>): Map<String, Throwable> =
+        threadIds.distinct().mapNotNull { threadId ->
+            try {
+                unsubscribeFromMessageEvents(threadId)
+                null
+            } catch (e: PrivmxException) {
+                threadId to e
+            } catch (e: NativeException) {
+                threadId to e
+            }
+        }.toMap()
+
     /**
      * Frees memory.
      *
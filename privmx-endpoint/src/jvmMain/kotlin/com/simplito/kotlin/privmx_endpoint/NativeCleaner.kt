@@ -0,0 +1,67 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint
+
+import java.lang.ref.PhantomReference
+import java.lang.ref.ReferenceQueue
+import java.util.concurrent.ConcurrentHashMap
+import java.util.concurrent.atomic.AtomicBoolean
+
+/**
+ * Releases native memory of objects that were garbage collected without being closed.
+ *
+ * Works like `java.lang.ref.Cleaner`, which is not available on the JVM 1.8 target.
+ */
+internal object NativeCleaner {
+    private val queue = ReferenceQueue<Any>()
+    private val registered: MutableSet<Cleanable> = ConcurrentHashMap.newKeySet()
+
+    init {
+        Thread({
+            while (true) {
+                try {
+                    (queue.remove() as Cleanable).clean()
+                } catch (_: InterruptedException) {
+                } catch (_: Throwable) {
+                }
+            }
+        }, "privmx-cleaner").apply {
+            isDaemon = true
+            start()
+        }
+    }
+
+    /**
+     * Registers [action] to run once [obj] becomes phantom reachable.
+     * The action must not reference [obj].
+     */
+    fun register(obj: Any, action: Runnable): Cleanable =
+        Cleanable(obj, action).also { registered.add(it) }
+
+    /**
+     * Runs the registered action at most once, either explicitly or after collection.
+     */
+    class Cleanable internal constructor(
+        referent: Any,
+        private val action: Runnable
+    ) : PhantomReference<Any>(referent, queue) {
+        private val cleaned = AtomicBoolean(false)
+
+        fun clean() {
+            if (cleaned.compareAndSet(false, true)) {
+                registered.remove(this)
+                clear()
+                action.run()
+            }
+        }
+    }
+}
@@ -0,0 +1,31 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint.model
+
+/**
+ * Counters of the native per-call arena used for temporary objects of JNI calls, summed over all threads.
+ *
+ * Only allocations requested from the arena are counted. Other temporaries of native calls, such as
+ * strings, vectors and paging queries passed to PrivMX Endpoint, use the general native heap and do not
+ * appear here, so these counters do not measure the total number of native allocations.
+ * In steady state [blockAllocations] and [unscopedAllocations] stay constant while [allocations] grows.
+ *
+ * @property allocations         Number of allocations served from the arena
+ * @property allocatedBytes      Number of bytes served from the arena
+ * @property blockAllocations    Number of arena blocks allocated on the native heap
+ * @property unscopedAllocations Number of arena allocations made outside a call, served from the native heap
+ */
+data class ArenaStats(
+    val allocations: Long,
+    val allocatedBytes: Long,
+    val blockAllocations: Long,
+    val unscopedAllocations: Long
+)
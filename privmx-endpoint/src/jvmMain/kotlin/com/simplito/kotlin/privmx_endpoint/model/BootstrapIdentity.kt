@@ -0,0 +1,26 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint.model
+
+/**
+ * Credentials of a user connected by [com.simplito.kotlin.privmx_endpoint.modules.core.Connection.bootstrapAsync].
+ *
+ * @property userPrivKey         user's private key
+ * @property solutionId          ID of the Solution
+ * @property bridgeUrl           PrivMX Bridge server URL
+ * @property verificationOptions PrivMX Bridge server instance verification options using a PKI server
+ */
+data class BootstrapIdentity @JvmOverloads constructor(
+    val userPrivKey: String,
+    val solutionId: String,
+    val bridgeUrl: String,
+    val verificationOptions: PKIVerificationOptions? = null
+)
@@ -0,0 +1,26 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint.model
+
+import com.simplito.kotlin.privmx_endpoint.modules.core.Connection
+
+/**
+ * Connections and listings of users bootstrapped together.
+ *
+ * @property identities results in the order of the bootstrapped identities
+ */
+class BootstrapSnapshot(val identities: List<IdentitySnapshot>) {
+    /**
+     * Connections of successfully bootstrapped users.
+     */
+    val connections: List<Connection>
+        get() = identities.mapNotNull { it.connection }
+}
@@ -0,0 +1,26 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint.model
+
+/**
+ * Context of a bootstrapped user with the first page of its containers.
+ *
+ * @property context Context information
+ * @property threads first page of Threads in the Context
+ * @property stores  first page of Stores in the Context
+ * @property inboxes first page of Inboxes in the Context
+ */
+data class ContextSnapshot(
+    val context: Context,
+    val threads: PagingList<Thread>,
+    val stores: PagingList<Store>,
+    val inboxes: PagingList<Inbox>
+)
@@ -0,0 +1,65 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint.model
+
+/**
+ * Selects which payload fields of messages, Inbox entries and files are copied from native memory.
+ *
+ * Fields excluded by the projection are returned as empty arrays; excluded entry files are returned
+ * as an empty list. Info fields (IDs, dates, authors, status codes) are always returned.
+ *
+ * @property data        copy message or entry data
+ * @property publicMeta  copy public meta of messages and files
+ * @property privateMeta copy private meta of messages and files
+ * @property files       copy the list of files attached to Inbox entries
+ */
+data class FieldProjection(
+    val data: Boolean = true,
+    val publicMeta: Boolean = true,
+    val privateMeta: Boolean = true,
+    val files: Boolean = true
+) {
+    internal val mask: Int
+        get() = (if (data) DATA else 0) or
+                (if (publicMeta) PUBLIC_META else 0) or
+                (if (privateMeta) PRIVATE_META else 0) or
+                (if (files) FILES else 0)
+
+    companion object {
+        private const val DATA = 1 shl 0
+        private const val PUBLIC_META = 1 shl 1
+        private const val PRIVATE_META = 1 shl 2
+        private const val FILES = 1 shl 3
+
+        /**
+         * Returns only info fields, without data, meta and entry files.
+         */
+        @JvmField
+        val INFO_ONLY = FieldProjection(
+            data = false,
+            publicMeta = false,
+            privateMeta = false,
+            files = false
+        )
+
+        /**
+         * Returns info fields and meta (including entry files with their meta), without data.
+         */
+        @JvmField
+        val META_ONLY = FieldProjection(data = false)
+
+        /**
+         * Returns all fields, same as the methods without projection.
+         */
+        @JvmField
+        val ALL = FieldProjection()
+    }
+}
@@ -0,0 +1,28 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint.model
+
+import com.simplito.kotlin.privmx_endpoint.modules.core.Connection
+
+/**
+ * Result of bootstrapping a single [BootstrapIdentity].
+ *
+ * When connecting or any listing fails, [error] is set, [connection] is `null` and [contexts] is empty.
+ *
+ * @property connection connection of the user, owned by the caller
+ * @property contexts   first page of Contexts of the user with their containers
+ * @property error      exception thrown while bootstrapping the user
+ */
+class IdentitySnapshot(
+    val connection: Connection?,
+    val contexts: List<ContextSnapshot>,
+    val error: Throwable?
+)
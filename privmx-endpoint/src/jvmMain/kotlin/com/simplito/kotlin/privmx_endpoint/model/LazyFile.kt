@@ -0,0 +1,63 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint.model
+
+import com.simplito.kotlin.privmx_endpoint.modules.core.NativeBuffer
+
+/**
+ * Holds information about the file with meta kept in native memory.
+ *
+ * Meta fields are copied to the Java heap only when accessed through [NativeBuffer.toByteArray]
+ * or viewed through [NativeBuffer.asByteBuffer].
+ *
+ * @property info         File's information created by server
+ * @property publicMeta   File's public metadata
+ * @property privateMeta  File's private metadata
+ * @property size         File's size
+ * @property authorPubKey Public key of the author of the file
+ * @property statusCode   Status code of retrieval and decryption of the file
+ * @property schemaVersion Version of the file data structure and how it is encoded/encrypted.
+ */
+class LazyFile(
+    val info: ServerFileInfo,
+    val publicMeta: NativeBuffer,
+    val privateMeta: NativeBuffer,
+    val size: Long?,
+    val authorPubKey: String,
+    val statusCode: Long?,
+    val schemaVersion: Long?
+) : AutoCloseable {
+
+    /**
+     * Copies the whole file information to the Java heap.
+     *
+     * @return [File] with materialized meta
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    fun toFile(): File = File(
+        info,
+        publicMeta.toByteArray(),
+        privateMeta.toByteArray(),
+        size,
+        authorPubKey,
+        statusCode,
+        schemaVersion
+    )
+
+    /**
+     * Frees native memory of the meta.
+     */
+    override fun close() {
+        publicMeta.close()
+        privateMeta.close()
+    }
+}
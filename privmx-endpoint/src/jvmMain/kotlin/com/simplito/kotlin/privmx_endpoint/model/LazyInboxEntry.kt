@@ -0,0 +1,66 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint.model
+
+import com.simplito.kotlin.privmx_endpoint.modules.core.NativeBuffer
+
+/**
+ * Holds information about Inbox entry with payload kept in native memory.
+ *
+ * Entry data and file meta are copied to the Java heap only when accessed through
+ * [NativeBuffer.toByteArray] or viewed through [NativeBuffer.asByteBuffer].
+ *
+ * @property entryId      ID of the entry
+ * @property inboxId      ID of the Inbox
+ * @property data         Entry data
+ * @property files        List of files attached to the entry
+ * @property authorPubKey Public key of the author of an entry
+ * @property createDate   Inbox entry creation timestamp
+ * @property statusCode   Status code of retrieval and decryption of the Inbox entry
+ * @property schemaVersion Version of the Entry data structure and how it is encoded/encrypted
+ */
+class LazyInboxEntry(
+    val entryId: String,
+    val inboxId: String,
+    val data: NativeBuffer,
+    val files: List<LazyFile>,
+    val authorPubKey: String,
+    val createDate: Long?,
+    val statusCode: Long?,
+    val schemaVersion: Long?
+) : AutoCloseable {
+
+    /**
+     * Copies the whole entry, including its files, to the Java heap.
+     *
+     * @return [InboxEntry] with materialized payload
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    fun toInboxEntry(): InboxEntry = InboxEntry(
+        entryId,
+        inboxId,
+        data.toByteArray(),
+        files.map(LazyFile::toFile),
+        authorPubKey,
+        createDate,
+        statusCode,
+        schemaVersion
+    )
+
+    /**
+     * Frees native memory of the entry data and its files.
+     */
+    override fun close() {
+        data.close()
+        files.forEach(LazyFile::close)
+    }
+}
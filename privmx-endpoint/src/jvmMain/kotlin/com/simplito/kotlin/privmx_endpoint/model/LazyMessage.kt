@@ -0,0 +1,64 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint.model
+
+import com.simplito.kotlin.privmx_endpoint.modules.core.NativeBuffer
+
+/**
+ * Holds information about the Message with payload kept in native memory.
+ *
+ * Payload fields are copied to the Java heap only when accessed through [NativeBuffer.toByteArray]
+ * or viewed through [NativeBuffer.asByteBuffer].
+ *
+ * @property info         Message's information created by server
+ * @property publicMeta   Message's public metadata
+ * @property privateMeta  Message's private metadata
+ * @property data         Message's data
+ * @property authorPubKey Public key of the author of the message
+ * @property statusCode   Status code of retrieval and decryption of the `Message`
+ * @property schemaVersion Version of the Message data structure and how it is encoded/encrypted.
+ */
+class LazyMessage(
+    val info: ServerMessageInfo,
+    val publicMeta: NativeBuffer,
+    val privateMeta: NativeBuffer,
+    val data: NativeBuffer,
+    val authorPubKey: String,
+    val statusCode: Long?,
+    val schemaVersion: Long?
+) : AutoCloseable {
+
+    /**
+     * Copies the whole message to the Java heap.
+     *
+     * @return [Message] with materialized payload
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    fun toMessage(): Message = Message(
+        info,
+        publicMeta.toByteArray(),
+        privateMeta.toByteArray(),
+        data.toByteArray(),
+        authorPubKey,
+        statusCode,
+        schemaVersion
+    )
+
+    /**
+     * Frees native memory of the payload.
+     */
+    override fun close() {
+        publicMeta.close()
+        privateMeta.close()
+        data.close()
+    }
+}
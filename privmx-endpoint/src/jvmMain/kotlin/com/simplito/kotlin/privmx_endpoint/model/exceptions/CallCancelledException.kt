@@ -0,0 +1,23 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+package com.simplito.kotlin.privmx_endpoint.model.exceptions
+
+/**
+ * Thrown when an async call is stopped by its [com.simplito.kotlin.privmx_endpoint.modules.core.CancellationToken].
+ *
+ * @param message          information about the exception
+ * @property deadlineExceeded `true` when the token deadline passed, `false` when the token was cancelled
+ */
+class CallCancelledException
+internal constructor(
+    message: String,
+    val deadlineExceeded: Boolean
+) : RuntimeException(message)
@@ -0,0 +1,99 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.core
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.NativeCleaner
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.CallCancelledException
+
+/**
+ * Cancels async calls and bounds their duration.
+ *
+ * Futures of async calls using the token are completed with [CallCancelledException] as soon as
+ * [cancel] is called or the deadline passes, releasing threads waiting for them.
+ * Calls which have not started yet are skipped; a request already sent to PrivMX Bridge finishes
+ * in the background and its result is dropped.
+ * One token can be shared by many calls, e.g. all requests of a single user action.
+ *
+ * Closing the token, or its garbage collection, detaches it from calls already started:
+ * they run to completion and their futures complete with their results, even after the deadline.
+ */
+class CancellationToken private constructor(ptr: Long) : AutoCloseable {
+    companion object {
+        init {
+            LibLoader.load()
+        }
+
+        /**
+         * Creates token without a deadline, cancelled only by [cancel].
+         *
+         * @return new token
+         */
+        @JvmStatic
+        fun create(): CancellationToken = CancellationToken(create(-1))
+
+        /**
+         * Creates token cancelled automatically after given time.
+         *
+         * @param timeoutMillis time from now after which calls using the token fail, in milliseconds
+         * @return new token
+         * @throws IllegalArgumentException thrown when [timeoutMillis] is negative
+         */
+        @JvmStatic
+        @Throws(IllegalArgumentException::class)
+        fun withTimeout(timeoutMillis: Long): CancellationToken {
+            require(timeoutMillis >= 0) { "Timeout cannot be negative" }
+            return CancellationToken(create(timeoutMillis))
+        }
+
+        @JvmStatic
+        private external fun create(timeoutMillis: Long): Long
+
+        @JvmStatic
+        private external fun free(ptr: Long)
+    }
+
+    private var token: Long? = ptr
+    private val cleanable = NativeCleaner.register(this) { free(ptr) }
+
+    /**
+     * `true` when the token was cancelled or its deadline passed.
+     *
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @get:Throws(IllegalStateException::class)
+    val isCancelled: Boolean
+        get() = isCancelledNative()
+
+    /**
+     * Cancels calls using this token. Calling this method on a cancelled token has no effect.
+     *
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    external fun cancel()
+
+    /**
+     * Frees native memory. Calls in progress are no longer cancelled by this token.
+     * Calling this method on a closed instance has no effect.
+     */
+    @Synchronized
+    override fun close() {
+        if (token != null) {
+            token = null
+            cleanable.clean()
+        }
+    }
+
+    @Throws(IllegalStateException::class)
+    private external fun isCancelledNative(): Boolean
+}
@@ -12,13 +12,18 @@
 package com.simplito.kotlin.privmx_endpoint.modules.core
 
 import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.model.BootstrapIdentity
+import com.simplito.kotlin.privmx_endpoint.model.BootstrapSnapshot
 import com.simplito.kotlin.privmx_endpoint.model.Context
+import com.simplito.kotlin.privmx_endpoint.model.IdentitySnapshot
 import com.simplito.kotlin.privmx_endpoint.model.PKIVerificationOptions
 import com.simplito.kotlin.privmx_endpoint.model.PagingList
 import com.simplito.kotlin.privmx_endpoint.model.UserInfo
 import com.simplito.kotlin.privmx_endpoint.modules.core.UserVerifierInterface
 import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
 import com.simplito.kotlin.privmx_endpoint.model.exceptions.PrivmxException
+import java.util.concurrent.CompletableFuture
+import java.util.concurrent.CompletionException
 
 /**
  * Manages a connection between the PrivMX Endpoint and PrivMX Bridge server.
@@ -52,6 +57,76 @@ actual class Connection private constructor(
             verificationOptions: PKIVerificationOptions?
         ): Connection
 
+        /**
+         * Connects to PrivMX Bridge server asynchronously.
+         *
+         * Connecting runs on a native thread pool, so the calling thread is not blocked.
+         * The returned future is completed exceptionally with [PrivmxException] or [NativeException]
+         * when connecting fails.
+         *
+         * @param userPrivKey user's private key
+         * @param solutionId  ID of the Solution
+         * @param bridgeUrl PrivMX Bridge server URL
+         * @param verificationOptions PrivMX Bridge server instance verification options using a PKI server
+         * @param token token cancelling the call, or null; a connection established after
+         * cancellation is disconnected
+         * @return future completed with Connection object
+         * @throws IllegalStateException thrown when [token] is closed
+         */
+        @JvmStatic
+        @JvmOverloads
+        @Throws(IllegalStateException::class)
+        external fun connectAsync(
+            userPrivKey: String,
+            solutionId: String,
+            bridgeUrl: String,
+            verificationOptions: PKIVerificationOptions? = null,
+            token: CancellationToken? = null
+        ): CompletableFuture<Connection>
+
+        /**
+         * Connects given users at once and lists their Contexts with Threads, Stores and Inboxes.
+         *
+         * Connections and listings run in parallel on native threads, so the time needed depends on
+         * the slowest user rather than on the number of users. Failure of one user does not affect the others;
+         * it is reported in [IdentitySnapshot.error]. Returned connections are owned by the caller.
+         *
+         * @param identities credentials of users to connect
+         * @param pageSize   number of Contexts and containers of each kind to list
+         * @param token      token cancelling the call, or null; connections established before
+         * cancellation are disconnected
+         * @return future completed with connections and listings of users
+         * @throws IllegalStateException thrown when [token] is closed
+         */
+        @JvmStatic
+        @JvmOverloads
+        @Throws(IllegalStateException::class)
+        external fun bootstrapAsync(
+            identities: List<BootstrapIdentity>,
+            pageSize: Long = 100,
+            token: CancellationToken? = null
+        ): CompletableFuture<BootstrapSnapshot>
+
+        /**
+         * Connects given users at once and lists their Contexts with Threads, Stores and Inboxes,
+         * blocking until all of them are done.
+         *
+         * @param identities credentials of users to connect
+         * @param pageSize   number of Contexts and containers of each kind to list
+         * @return connections and listings of users
+         * @see bootstrapAsync
+         */
+        @JvmStatic
+        @JvmOverloads
+        fun bootstrap(
+            identities: List<BootstrapIdentity>,
+            pageSize: Long = 100
+        ): BootstrapSnapshot = try {
+            bootstrapAsync(identities, pageSize).join()
+        } catch (e: CompletionException) {
+            throw e.cause ?: e
+        }
+
         /**
          * Connects to PrivMX Bridge server as a guest user.
          *
@@ -133,6 +208,29 @@ actual class Connection private constructor(
         queryAsJson: String?
     ): PagingList<Context>
 
+    /**
+     * Gets a list of Contexts using sort order and filter of a [PreparedQuery].
+     *
+     * @param skip   skip number of elements to skip from result
+     * @param limit  limit of elements to return for query
+     * @param query  prepared sort order and filter
+     * @param lastId ID of the element from which query results should start
+     * @return list of Contexts
+     * @throws IllegalStateException thrown when instance is not connected or [query] is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    fun listContexts(
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String? = null
+    ): PagingList<Context> = listContextsPrepared(
+        skip, limit, query, lastId
+    )
+
     /**
      * Sets user's custom verification callback.
      *
@@ -171,6 +269,14 @@ actual class Connection private constructor(
     @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
     actual external fun disconnect()
 
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listContextsPrepared(
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String?
+    ): PagingList<Context>
+
     private external fun deinit()
 }
 
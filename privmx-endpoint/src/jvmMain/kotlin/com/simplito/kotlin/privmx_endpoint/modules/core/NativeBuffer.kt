@@ -0,0 +1,114 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.core
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.NativeCleaner
+import java.nio.ByteBuffer
+
+/**
+ * Holds bytes returned by PrivMX Endpoint in native memory, without copying them to the Java heap.
+ *
+ * Native memory is released by [close] or, if the instance was not closed, after it is garbage collected.
+ * Views returned by [asByteBuffer] hold their own reference to the native memory, which is released
+ * only after this instance and all of its views are closed or collected.
+ *
+ * Instances can be used from multiple threads.
+ */
+class NativeBuffer private constructor(ptr: Long) : AutoCloseable {
+    companion object {
+        init {
+            LibLoader.load()
+        }
+
+        private val EMPTY: ByteBuffer = ByteBuffer.allocate(0).asReadOnlyBuffer()
+
+        @JvmStatic
+        private external fun free(ptr: Long)
+
+        @JvmStatic
+        private external fun directView(ref: Long): ByteBuffer
+    }
+
+    private var buffer: Long? = ptr
+    private val cleanable = NativeCleaner.register(this) { free(ptr) }
+
+    /**
+     * Size of the buffer in bytes.
+     *
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @get:Throws(IllegalStateException::class)
+    val size: Long
+        @Synchronized get() = getSize()
+
+    /**
+     * Copies the buffer to a new byte array.
+     *
+     * @return copy of the buffer
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Synchronized
+    @Throws(IllegalStateException::class)
+    fun toByteArray(): ByteArray = copyToByteArray()
+
+    /**
+     * Returns a read-only direct view of the native memory, without copying it.
+     * The view stays valid after this instance is closed; its memory is released once the view is collected.
+     * Buffers derived from the view (e.g. by [ByteBuffer.duplicate] or [ByteBuffer.slice]) do not keep
+     * it reachable on every runtime (e.g. Android), so the view has to be kept while they are used.
+     *
+     * @return read-only [ByteBuffer] backed by native memory
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Synchronized
+    @Throws(IllegalStateException::class)
+    fun asByteBuffer(): ByteBuffer {
+        if (getSize() == 0L) {
+            return EMPTY.duplicate()
+        }
+        val rootRef = retain()
+        val root = try {
+            directView(rootRef)
+        } catch (e: Throwable) {
+            free(rootRef)
+            throw e
+        }
+        NativeCleaner.register(root) { free(rootRef) }
+        // On ART derived buffers do not reference their root, so the returned view holds its own reference
+        val viewRef = retain()
+        val view = root.asReadOnlyBuffer()
+        NativeCleaner.register(view) { free(viewRef) }
+        return view
+    }
+
+    /**
+     * Releases this instance's reference to native memory, which is freed once no views use it.
+     * Calling this method on a closed instance has no effect.
+     */
+    @Synchronized
+    override fun close() {
+        if (buffer != null) {
+            buffer = null
+            cleanable.clean()
+        }
+    }
+
+    @Throws(IllegalStateException::class)
+    private external fun getSize(): Long
+
+    @Throws(IllegalStateException::class)
+    private external fun copyToByteArray(): ByteArray
+
+    @Throws(IllegalStateException::class)
+    private external fun retain(): Long
+}
@@ -0,0 +1,37 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.core
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.model.ArenaStats
+
+/**
+ * Exposes counters of the native library for diagnostics.
+ */
+object NativeDiagnostics {
+    init {
+        LibLoader.load()
+    }
+
+    /**
+     * Gets counters of the native per-call arena.
+     * They cover arena allocations only, not all native heap allocations; see [ArenaStats].
+     *
+     * @return current arena counters
+     */
+    external fun getArenaStats(): ArenaStats
+
+    /**
+     * Resets counters of the native per-call arena to zero.
+     */
+    external fun resetArenaStats()
+}
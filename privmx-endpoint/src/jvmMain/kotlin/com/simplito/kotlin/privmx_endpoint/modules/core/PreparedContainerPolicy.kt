@@ -0,0 +1,73 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.core
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.NativeCleaner
+import com.simplito.kotlin.privmx_endpoint.model.ContainerPolicy
+
+/**
+ * [ContainerPolicy] with a native copy prepared once for repeated calls.
+ *
+ * Can be passed wherever a [ContainerPolicy] or ContainerPolicyWithoutItem is expected, e.g. to createThread,
+ * updateStore or createInbox; the native copy is used instead of reading the policy on each call.
+ * After [close] (or if the instance is garbage collected) it behaves like a regular policy.
+ * The instance must not be closed while a call using it is in progress.
+ */
+class PreparedContainerPolicy private constructor(
+    policy: ContainerPolicy,
+    ptr: Long
+) : ContainerPolicy(
+    policy.get,
+    policy.update,
+    policy.delete,
+    policy.updatePolicy,
+    policy.updaterCanBeRemovedFromManagers,
+    policy.ownerCanBeRemovedFromManagers,
+    policy.item
+), AutoCloseable {
+    companion object {
+        init {
+            LibLoader.load()
+        }
+
+        /**
+         * Prepares given policy.
+         *
+         * @param policy policy to prepare
+         * @return prepared policy
+         */
+        @JvmStatic
+        fun of(policy: ContainerPolicy): PreparedContainerPolicy =
+            PreparedContainerPolicy(policy, create(policy))
+
+        @JvmStatic
+        private external fun create(policy: ContainerPolicy): Long
+
+        @JvmStatic
+        private external fun free(ptr: Long)
+    }
+
+    private var preparedPolicy: Long? = ptr
+    private val cleanable = NativeCleaner.register(this) { free(ptr) }
+
+    /**
+     * Frees native memory. Calling this method on a closed instance has no effect.
+     */
+    @Synchronized
+    override fun close() {
+        if (preparedPolicy != null) {
+            preparedPolicy = null
+            cleanable.clean()
+        }
+    }
+}
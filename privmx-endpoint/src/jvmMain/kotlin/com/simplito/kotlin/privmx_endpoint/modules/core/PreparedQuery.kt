@@ -0,0 +1,77 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.core
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.NativeCleaner
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
+
+/**
+ * Sort order and filter of paging queries, validated and copied to native memory once.
+ *
+ * Pass it to list methods together with `skip`, `limit` and `lastId` when paging through the same
+ * query repeatedly; only these values are passed on each call.
+ * The instance must not be closed while a call using it is in progress.
+ *
+ * @property sortOrder   order of elements in result ("asc" for ascending, "desc" for descending)
+ * @property queryAsJson stringified JSON object with a custom field to filter result
+ */
+class PreparedQuery private constructor(
+    val sortOrder: String,
+    val queryAsJson: String?,
+    ptr: Long
+) : AutoCloseable {
+    companion object {
+        init {
+            LibLoader.load()
+        }
+
+        /**
+         * Prepares query with given sort order and filter.
+         *
+         * @param sortOrder   order of elements in result ("asc" for ascending, "desc" for descending)
+         * @param queryAsJson stringified JSON object with a custom field to filter result
+         * @return prepared query
+         * @throws IllegalArgumentException thrown when sort order is not "asc" or "desc"
+         * @throws NativeException          thrown when [queryAsJson] is not a valid JSON object
+         */
+        @JvmStatic
+        @JvmOverloads
+        @Throws(IllegalArgumentException::class, NativeException::class)
+        fun of(sortOrder: String = "desc", queryAsJson: String? = null): PreparedQuery {
+            require(sortOrder == "asc" || sortOrder == "desc") {
+                "Sort order must be \"asc\" or \"desc\""
+            }
+            return PreparedQuery(sortOrder, queryAsJson, create(sortOrder, queryAsJson))
+        }
+
+        @JvmStatic
+        private external fun create(sortOrder: String, queryAsJson: String?): Long
+
+        @JvmStatic
+        private external fun free(ptr: Long)
+    }
+
+    private var prepared: Long? = ptr
+    private val cleanable = NativeCleaner.register(this) { free(ptr) }
+
+    /**
+     * Frees native memory. Calling this method on a closed instance has no effect.
+     */
+    @Synchronized
+    override fun close() {
+        if (prepared != null) {
+            prepared = null
+            cleanable.clean()
+        }
+    }
+}
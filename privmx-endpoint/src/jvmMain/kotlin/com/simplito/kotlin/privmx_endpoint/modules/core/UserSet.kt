@@ -0,0 +1,72 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.core
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.NativeCleaner
+import com.simplito.kotlin.privmx_endpoint.model.UserWithPubKey
+
+/**
+ * Immutable list of users with a native copy prepared once for repeated calls.
+ *
+ * Can be passed wherever a users or managers list is expected, e.g. to createThread, updateStore,
+ * createInbox or EventApi.emitEvent; the native copy is used instead of reading the list on each call.
+ * After [close] (or if the instance is garbage collected) it behaves like a regular list.
+ * The instance must not be closed while a call using it is in progress.
+ */
+class UserSet private constructor(
+    private val items: List<UserWithPubKey>,
+    ptr: Long
+) : AbstractList<UserWithPubKey>(), AutoCloseable {
+    companion object {
+        init {
+            LibLoader.load()
+        }
+
+        /**
+         * Creates [UserSet] with given users.
+         *
+         * @param users users to include in the set
+         * @return created [UserSet]
+         */
+        @JvmStatic
+        fun of(users: List<UserWithPubKey>): UserSet {
+            val copy = users.toList()
+            return UserSet(copy, create(copy.toTypedArray()))
+        }
+
+        @JvmStatic
+        private external fun create(users: Array<UserWithPubKey>): Long
+
+        @JvmStatic
+        private external fun free(ptr: Long)
+    }
+
+    private var userSet: Long? = ptr
+    private val cleanable = NativeCleaner.register(this) { free(ptr) }
+
+    override val size: Int
+        get() = items.size
+
+    override fun get(index: Int): UserWithPubKey = items[index]
+
+    /**
+     * Frees native memory. Calling this method on a closed instance has no effect.
+     */
+    @Synchronized
+    override fun close() {
+        if (userSet != null) {
+            userSet = null
+            cleanable.clean()
+        }
+    }
+}
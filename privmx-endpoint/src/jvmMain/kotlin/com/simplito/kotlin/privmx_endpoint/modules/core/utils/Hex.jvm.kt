@@ -12,6 +12,7 @@
 package com.simplito.kotlin.privmx_endpoint.modules.core.utils
 
 import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.modules.core.NativeBuffer
 
 actual object Hex {
     init {
@@ -34,6 +35,14 @@ actual object Hex {
      */
     actual external fun decode(hexData: String): ByteArray
 
+    /**
+     * Decodes string in Hex into native memory, without copying the result to the Java heap.
+     *
+     * @param hexData string to decode
+     * @return decoded data held in native memory
+     */
+    external fun decodeDirect(hexData: String): NativeBuffer
+
     /**
      * Checks if given string is in Hex format.
      *
@@ -14,7 +14,10 @@ import com.simplito.kotlin.privmx_endpoint.model.BIP39
 import com.simplito.kotlin.privmx_endpoint.LibLoader
 import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
 import com.simplito.kotlin.privmx_endpoint.model.exceptions.PrivmxException
+import com.simplito.kotlin.privmx_endpoint.modules.core.CancellationToken
+import com.simplito.kotlin.privmx_endpoint.modules.core.NativeBuffer
 import java.lang.AutoCloseable
+import java.util.concurrent.CompletableFuture
 
 /**
  * Defines cryptographic methods.
@@ -25,6 +28,20 @@ actual class CryptoApi : AutoCloseable {
         init {
             LibLoader.load()
         }
+
+        /**
+         * Configures cache of results of [mnemonicToSeedAsync], [fromMnemonicAsync] and [derivePrivateKey2Async],
+         * shared by all instances. Results are kept in memory for [ttlMillis] milliseconds and looked up by
+         * SHA-256 hash of the call arguments, so repeated derivations with the same inputs complete at once.
+         * The cache is disabled by default; passing 0 as any argument disables it and drops cached results.
+         *
+         * @param ttlMillis  time in milliseconds a result is kept
+         * @param maxEntries maximum number of cached results; the ones closest to expiry are dropped first
+         * @throws NativeException thrown when any of the arguments is negative
+         */
+        @JvmStatic
+        @Throws(NativeException::class)
+        external fun setKdfCache(ttlMillis: Long, maxEntries: Int)
     }
 
     private val api: Long? = init()
@@ -100,6 +117,100 @@ actual class CryptoApi : AutoCloseable {
     @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
     actual external fun decryptDataSymmetric(data: ByteArray, symmetricKey: ByteArray): ByteArray
 
+    /**
+     * Decrypts buffer with a given key using AES, keeping the result in native memory.
+     *
+     * @param data         buffer to decrypt
+     * @param symmetricKey key used to decrypt data
+     * @return Plain (decrypted) data held in native memory
+     * @throws PrivmxException thrown when method encounters an exception
+     * @throws NativeException thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun decryptDataSymmetricDirect(data: ByteArray, symmetricKey: ByteArray): NativeBuffer
+
+    /**
+     * Encrypts each buffer with its key using AES, within a single native call.
+     * Batches larger than 64 KiB in total are processed on all available cores.
+     *
+     * @param data          buffers to encrypt
+     * @param symmetricKeys key for each buffer (at the same index), or a single key used for all buffers
+     * @return Encrypted buffers in the order of [data]
+     * @throws PrivmxException thrown when processing any of the buffers fails
+     * @throws NativeException thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun encryptBatch(data: List<ByteArray>, symmetricKeys: List<ByteArray>): List<ByteArray>
+
+    /**
+     * Encrypts each buffer with the same key using AES, within a single native call.
+     * Batches larger than 64 KiB in total are processed on all available cores.
+     *
+     * @param data         buffers to encrypt
+     * @param symmetricKey key used to encrypt all buffers
+     * @return Encrypted buffers in the order of [data]
+     * @throws PrivmxException thrown when processing any of the buffers fails
+     * @throws NativeException thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    fun encryptBatch(data: List<ByteArray>, symmetricKey: ByteArray): List<ByteArray> =
+        encryptBatch(data, listOf(symmetricKey))
+
+    /**
+     * Decrypts each buffer with its key using AES, within a single native call.
+     * Batches larger than 64 KiB in total are processed on all available cores.
+     *
+     * @param data          buffers to decrypt
+     * @param symmetricKeys key for each buffer (at the same index), or a single key used for all buffers
+     * @return Plain (decrypted) buffers in the order of [data]
+     * @throws PrivmxException thrown when processing any of the buffers fails
+     * @throws NativeException thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun decryptBatch(data: List<ByteArray>, symmetricKeys: List<ByteArray>): List<ByteArray>
+
+    /**
+     * Decrypts each buffer with the same key using AES, within a single native call.
+     * Batches larger than 64 KiB in total are processed on all available cores.
+     *
+     * @param data         buffers to decrypt
+     * @param symmetricKey key used to decrypt all buffers
+     * @return Plain (decrypted) buffers in the order of [data]
+     * @throws PrivmxException thrown when processing any of the buffers fails
+     * @throws NativeException thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    fun decryptBatch(data: List<ByteArray>, symmetricKey: ByteArray): List<ByteArray> =
+        decryptBatch(data, listOf(symmetricKey))
+
+    /**
+     * Opens stream encrypting data of any size chunk by chunk, in bounded memory.
+     * Stream output can be decrypted only with [openDecryptStream]; see [SymmetricCipherStream] for its format.
+     *
+     * @param symmetricKey key used to encrypt data
+     * @return stream ready to encrypt data, which must be closed after use
+     * @throws NativeException thrown when key has invalid size
+     */
+    @Throws(NativeException::class)
+    fun openEncryptStream(symmetricKey: ByteArray): SymmetricCipherStream =
+        SymmetricCipherStream.openEncrypt(symmetricKey)
+
+    /**
+     * Opens stream decrypting data encrypted with [openEncryptStream] chunk by chunk, in bounded memory.
+     *
+     * @param symmetricKey key used to encrypt data
+     * @return stream ready to decrypt data, which must be closed after use
+     * @throws NativeException thrown when key has invalid size
+     */
+    @Throws(NativeException::class)
+    fun openDecryptStream(symmetricKey: ByteArray): SymmetricCipherStream =
+        SymmetricCipherStream.openDecrypt(symmetricKey)
+
     /**
      * Creates a signature of data using given key.
      *
@@ -131,6 +242,52 @@ actual class CryptoApi : AutoCloseable {
         publicKey: String
     ): Boolean
 
+    /**
+     * Validates signature of each data buffer within a single native call.
+     * Batches of 8 or more signatures are verified on all available cores.
+     *
+     * @param data       buffers
+     * @param signatures signature for each buffer (at the same index)
+     * @param publicKeys public ECC key in BASE58DER format for each buffer (at the same index),
+     * or a single key used for all buffers
+     * @return validation result for each buffer in the order of [data]
+     * @throws PrivmxException thrown when validating any of the buffers fails
+     * @throws NativeException thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun verifyBatch(
+        data: List<ByteArray>,
+        signatures: List<ByteArray>,
+        publicKeys: List<String>
+    ): BooleanArray
+
+    /**
+     * Validates signature of each data buffer with the same key, within a single native call.
+     * Batches of 8 or more signatures are verified on all available cores.
+     *
+     * @param data       buffers
+     * @param signatures signature for each buffer (at the same index)
+     * @param publicKey  public ECC key in BASE58DER format used to validate all buffers
+     * @return validation result for each buffer in the order of [data]
+     * @throws PrivmxException thrown when validating any of the buffers fails
+     * @throws NativeException thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    fun verifyBatch(data: List<ByteArray>, signatures: List<ByteArray>, publicKey: String): BooleanArray =
+        verifyBatch(data, signatures, listOf(publicKey))
+
+    /**
+     * Opens stream signing or verifying data of any size chunk by chunk, in bounded memory.
+     * See [SignatureStream] for what the signature covers.
+     *
+     * @return stream ready to process data, which must be closed after use
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    fun openSignatureStream(): SignatureStream = SignatureStream.open(this)
+
     /**
      * Converts given private key in PEM format to its WIF format.
      *
@@ -235,6 +392,70 @@ actual class CryptoApi : AutoCloseable {
     @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
     actual external fun mnemonicToSeed(mnemonic: String, password: String): ByteArray
 
+    /**
+     * Generates a seed using BIP-39 mnemonic with PBKDF2 asynchronously.
+     *
+     * Derivation runs on a native pool with one thread per core, so the calling thread is not blocked.
+     * The returned future is completed exceptionally with [PrivmxException] or [NativeException]
+     * when the derivation fails. Results may be served from cache configured with [setKdfCache].
+     *
+     * @param mnemonic BIP-39 mnemonic
+     * @param password the password used to generate the seed
+     * @param token    token cancelling the call, or null
+     * @return future completed with generated seed
+     * @throws IllegalStateException thrown when instance or [token] is closed
+     */
+    @Throws(IllegalStateException::class)
+    @JvmOverloads
+    external fun mnemonicToSeedAsync(
+        mnemonic: String,
+        password: String,
+        token: CancellationToken? = null
+    ): CompletableFuture<ByteArray>
+
+    /**
+     * Generates ECC key using BIP-39 mnemonic asynchronously.
+     *
+     * Derivation runs on a native pool with one thread per core, so the calling thread is not blocked.
+     * The returned future is completed exceptionally with [PrivmxException] or [NativeException]
+     * when the derivation fails. Results may be served from cache configured with [setKdfCache].
+     *
+     * @param mnemonic the BIP-39 entropy used to generate the Key
+     * @param password the password used to generate the Key
+     * @param token    token cancelling the call, or null
+     * @return future completed with BIP39 object containing ECC Key and associated with it BIP-39 mnemonic and entropy
+     * @throws IllegalStateException thrown when instance or [token] is closed
+     */
+    @Throws(IllegalStateException::class)
+    @JvmOverloads
+    external fun fromMnemonicAsync(
+        mnemonic: String,
+        password: String,
+        token: CancellationToken? = null
+    ): CompletableFuture<BIP39>
+
+    /**
+     * Generates a new private ECC key from a password using pbkdf2 asynchronously.
+     * Produces the same key as [derivePrivateKey2].
+     *
+     * Derivation runs on a native pool with one thread per core, so the calling thread is not blocked.
+     * The returned future is completed exceptionally with [PrivmxException] or [NativeException]
+     * when the derivation fails. Results may be served from cache configured with [setKdfCache].
+     *
+     * @param password the password used to generate the new key
+     * @param salt     random string (additional input for the hashing function)
+     * @param token    token cancelling the call, or null
+     * @return future completed with generated ECC key in WIF format
+     * @throws IllegalStateException thrown when instance or [token] is closed
+     */
+    @Throws(IllegalStateException::class)
+    @JvmOverloads
+    external fun derivePrivateKey2Async(
+        password: String,
+        salt: String,
+        token: CancellationToken? = null
+    ): CompletableFuture<String>
+
     /**
      * Generates a new symmetric key.
      *
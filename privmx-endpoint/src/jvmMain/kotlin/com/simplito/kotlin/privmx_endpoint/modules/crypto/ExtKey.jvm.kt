@@ -91,6 +91,20 @@ actual class ExtKey : AutoCloseable {
     @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
     actual external fun deriveHardened(index: Int): ExtKey
 
+    /**
+     * Generates descendant ExtKey at given BIP32 path within a single native call.
+     * Use [ExtKeyDerivationCache] when deriving many keys sharing parents.
+     *
+     * @param path path such as `m/44'/0'/0'/0/1`, where `m` stands for this key;
+     * hardened levels are marked with `'` or `h`
+     * @return ExtKey object
+     * @throws PrivmxException thrown when method encounters an exception
+     * @throws NativeException thrown when [path] is malformed
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun derivePath(path: String): ExtKey
+
     /**
      * Converts ExtKey to Base58 string.
      *
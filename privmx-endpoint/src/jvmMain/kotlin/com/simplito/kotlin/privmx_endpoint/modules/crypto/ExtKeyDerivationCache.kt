@@ -0,0 +1,97 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.crypto
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.NativeCleaner
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.PrivmxException
+
+/**
+ * Derives keys from a single root [ExtKey], remembering recently derived keys in native memory.
+ *
+ * Every key on a derived path is cached, so deriving siblings (e.g. `m/44'/0'/0'/0/1` after `m/44'/0'/0'/0/0`)
+ * only derives the levels below their longest cached common parent. The cache holds at most `capacity` keys,
+ * evicting least recently used ones. Cached keys include private keys of [root]'s descendants;
+ * close the cache as soon as it is no longer needed.
+ *
+ * Instances can be used from multiple threads.
+ */
+class ExtKeyDerivationCache private constructor(ptr: Long) : AutoCloseable {
+    companion object {
+        init {
+            LibLoader.load()
+        }
+
+        /**
+         * Default maximum number of cached keys.
+         */
+        const val DEFAULT_CAPACITY: Int = 1024
+
+        /**
+         * Creates cache deriving keys from given root.
+         * The root is copied, so it can be closed independently of the cache.
+         *
+         * @param root     key the derived paths start from
+         * @param capacity maximum number of cached keys
+         * @return empty cache
+         * @throws NativeException       thrown when [capacity] is not positive
+         * @throws IllegalStateException thrown when [root] is closed
+         */
+        @JvmStatic
+        @JvmOverloads
+        @Throws(NativeException::class, IllegalStateException::class)
+        fun open(root: ExtKey, capacity: Int = DEFAULT_CAPACITY) = ExtKeyDerivationCache(create(root, capacity))
+
+        @JvmStatic
+        private external fun create(root: ExtKey, capacity: Int): Long
+
+        @JvmStatic
+        private external fun free(ptr: Long)
+    }
+
+    private var cache: Long? = ptr
+    private val cleanable = NativeCleaner.register(this) { free(ptr) }
+
+    /**
+     * Derives key at given BIP32 path from the root, reusing cached parent keys.
+     *
+     * @param path path such as `m/44'/0'/0'/0/1`, where `m` stands for the root;
+     * hardened levels are marked with `'` or `h`
+     * @return ExtKey object, which must be closed after use
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when [path] is malformed
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun derivePath(path: String): ExtKey
+
+    /**
+     * Removes all cached keys.
+     *
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    external fun clear()
+
+    /**
+     * Frees native memory, including all cached keys.
+     * Calling this method on a closed instance has no effect.
+     */
+    @Synchronized
+    override fun close() {
+        if (cache != null) {
+            cache = null
+            cleanable.clean()
+        }
+    }
+}
@@ -0,0 +1,143 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.crypto
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.NativeCleaner
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.PrivmxException
+
+/**
+ * Generates keys ahead of demand on a native background thread, so taking a key does not wait for its generation.
+ *
+ * For each enabled [Kind] the pool keeps up to `depth` keys and refills the queue as keys are taken.
+ * Private and symmetric keys wait in native memory locked in RAM (see [isLocked]) and are wiped once taken.
+ * Extended keys are kept in memory managed by the core library.
+ * When a queue is empty, the key is generated on the calling thread, as with [CryptoApi] and [ExtKey].
+ *
+ * Instances can be used from multiple threads.
+ */
+class KeyPool private constructor(ptr: Long) : AutoCloseable {
+    /**
+     * Kinds of keys generated in advance.
+     */
+    enum class Kind(internal val flag: Int) {
+        /**
+         * Private keys as returned by [CryptoApi.generatePrivateKey] without seed.
+         */
+        PRIVATE_KEY(1),
+
+        /**
+         * Symmetric keys as returned by [CryptoApi.generateKeySymmetric].
+         */
+        SYMMETRIC_KEY(2),
+
+        /**
+         * Extended keys as returned by [ExtKey.generateRandom].
+         */
+        EXT_KEY(4)
+    }
+
+    companion object {
+        init {
+            LibLoader.load()
+        }
+
+        /**
+         * Default number of keys of each kind kept ready.
+         */
+        const val DEFAULT_DEPTH: Int = 16
+
+        /**
+         * Opens pool and starts generating keys in the background.
+         *
+         * @param cryptoApi Crypto API used to generate keys
+         * @param depth     number of keys of each kind kept ready
+         * @param kinds     kinds of keys generated in advance
+         * @return pool generating keys
+         * @throws NativeException       thrown when [depth] is not positive
+         * @throws IllegalStateException thrown when [cryptoApi] is closed
+         */
+        @JvmStatic
+        @JvmOverloads
+        @Throws(NativeException::class, IllegalStateException::class)
+        fun open(
+            cryptoApi: CryptoApi,
+            depth: Int = DEFAULT_DEPTH,
+            kinds: Set<Kind> = Kind.entries.toSet()
+        ) = KeyPool(create(cryptoApi, depth, kinds.fold(0) { flags, kind -> flags or kind.flag }))
+
+        @JvmStatic
+        private external fun create(cryptoApi: CryptoApi, depth: Int, kinds: Int): Long
+
+        @JvmStatic
+        private external fun free(ptr: Long)
+    }
+
+    private var pool: Long? = ptr
+    private val cleanable = NativeCleaner.register(this) { free(ptr) }
+
+    /**
+     * Takes a new private ECC key.
+     *
+     * @return private key in WIF format
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun takePrivateKey(): String
+
+    /**
+     * Takes a new symmetric key.
+     *
+     * @return generated key
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun takeKeySymmetric(): ByteArray
+
+    /**
+     * Takes a new random ExtKey.
+     *
+     * @return ExtKey object, which must be closed after use
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun takeExtKey(): ExtKey
+
+    /**
+     * Checks whether memory holding private and symmetric keys is locked in RAM.
+     * Locking may be refused by the system, e.g. when the process exceeds its limit of locked memory.
+     *
+     * @return true if waiting keys are never swapped to disk
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    external fun isLocked(): Boolean
+
+    /**
+     * Stops the background thread and wipes keys that were not taken.
+     * Calling this method on a closed instance has no effect.
+     */
+    @Synchronized
+    override fun close() {
+        if (pool != null) {
+            pool = null
+            cleanable.clean()
+        }
+    }
+}
@@ -0,0 +1,124 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.crypto
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.NativeCleaner
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.PrivmxException
+import java.nio.ByteBuffer
+
+/**
+ * Signs or verifies data of any size fed chunk by chunk, in bounded memory.
+ *
+ * Data is hashed with SHA-256 as it arrives; [sign] and [verify] then sign or verify the message
+ * `"privmx-endpoint/signature-stream/v1\u0000" + SHA-256(data)` with [CryptoApi.signData] and
+ * [CryptoApi.verifySignature]. Stream signatures are therefore a separate scheme: they do not match
+ * [CryptoApi.signData] of the same data, cannot verify signatures created by it, and are never valid
+ * signatures of a bare digest.
+ *
+ * Call [update] for consecutive chunks, then [sign] or [verify] once. Instances are not thread-safe.
+ */
+class SignatureStream private constructor(ptr: Long) : AutoCloseable {
+    companion object {
+        init {
+            LibLoader.load()
+        }
+
+        /**
+         * Opens stream using given Crypto API to sign or verify data.
+         *
+         * @param cryptoApi Crypto API used to sign or verify digest of data
+         * @return stream ready to process data
+         * @throws IllegalStateException thrown when [cryptoApi] is closed
+         */
+        @JvmStatic
+        @Throws(IllegalStateException::class)
+        fun open(cryptoApi: CryptoApi) = SignatureStream(create(cryptoApi))
+
+        @JvmStatic
+        private external fun create(cryptoApi: CryptoApi): Long
+
+        @JvmStatic
+        private external fun free(ptr: Long)
+    }
+
+    private var stream: Long? = ptr
+    private val cleanable = NativeCleaner.register(this) { free(ptr) }
+
+    /**
+     * Processes next chunk of data.
+     *
+     * @param chunk next chunk of data
+     * @throws IllegalStateException thrown when instance is closed or finished
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(IllegalStateException::class, NativeException::class)
+    external fun update(chunk: ByteArray)
+
+    /**
+     * Processes remaining bytes of [input], advancing its position.
+     * Direct buffers are read in place, without copying them to the Java heap.
+     *
+     * @param input next chunk of data
+     * @throws IllegalStateException thrown when instance is closed or finished
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(IllegalStateException::class, NativeException::class)
+    fun update(input: ByteBuffer) {
+        if (input.isDirect) {
+            updateDirect(input, input.position(), input.remaining())
+        } else {
+            update(ByteArray(input.remaining()).also { input.duplicate().get(it) })
+        }
+        input.position(input.limit())
+    }
+
+    /**
+     * Finishes processing and signs the tagged digest of processed data.
+     *
+     * @param privateKey key used to sign data
+     * @return stream signature of data
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed or already finished
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun sign(privateKey: String): ByteArray
+
+    /**
+     * Finishes processing and verifies stream signature of processed data.
+     *
+     * @param signature signature created with [sign]
+     * @param publicKey public key of the key used to sign data
+     * @return data validation result
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed or already finished
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun verify(signature: ByteArray, publicKey: String): Boolean
+
+    /**
+     * Frees native memory. Calling this method on a closed instance has no effect.
+     */
+    @Synchronized
+    override fun close() {
+        if (stream != null) {
+            stream = null
+            cleanable.clean()
+        }
+    }
+
+    @Throws(IllegalStateException::class, NativeException::class)
+    private external fun updateDirect(input: ByteBuffer, offset: Int, length: Int)
+}
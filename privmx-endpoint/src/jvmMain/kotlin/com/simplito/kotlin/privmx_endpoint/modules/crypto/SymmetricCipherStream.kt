@@ -0,0 +1,173 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.crypto
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.NativeCleaner
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
+import java.nio.ByteBuffer
+
+/**
+ * Encrypts or decrypts data of any size chunk by chunk using AES-256-GCM, in bounded memory.
+ *
+ * Encrypted data consists of an 8-byte format marker (`PMXSGCM` followed by version 1), a random 12-byte IV,
+ * the ciphertext and a 16-byte authentication tag, so it is [OVERHEAD] bytes longer than the plain data.
+ * The marker is authenticated together with the ciphertext. This format differs from the one produced by
+ * [CryptoApi.encryptDataSymmetric]; data encrypted by one cannot be decrypted by the other, and decryption
+ * of data without the marker fails at once.
+ *
+ * Call [update] for consecutive chunks, then [doFinal] once. When decrypting, data returned by
+ * [update] must not be trusted until [doFinal] succeeds, as only then the authentication tag is verified.
+ * Instances are not thread-safe.
+ */
+class SymmetricCipherStream private constructor(ptr: Long) : AutoCloseable {
+    companion object {
+        init {
+            LibLoader.load()
+        }
+
+        /**
+         * Number of bytes by which encrypted data is longer than plain data.
+         */
+        const val OVERHEAD: Int = 36
+
+        /**
+         * Maximum number of bytes by which output of [update] can be longer than its input.
+         */
+        const val MAX_UPDATE_OVERHEAD: Int = 36
+
+        /**
+         * Opens stream encrypting data with given key.
+         *
+         * @param symmetricKey 32-byte key, e.g. generated with [CryptoApi.generateKeySymmetric]
+         * @return stream ready to encrypt data
+         * @throws NativeException thrown when key has invalid size
+         */
+        @JvmStatic
+        @Throws(NativeException::class)
+        fun openEncrypt(symmetricKey: ByteArray) = SymmetricCipherStream(create(symmetricKey, true))
+
+        /**
+         * Opens stream decrypting data encrypted by [openEncrypt] stream with given key.
+         *
+         * @param symmetricKey 32-byte key used to encrypt data
+         * @return stream ready to decrypt data
+         * @throws NativeException thrown when key has invalid size
+         */
+        @JvmStatic
+        @Throws(NativeException::class)
+        fun openDecrypt(symmetricKey: ByteArray) = SymmetricCipherStream(create(symmetricKey, false))
+
+        @JvmStatic
+        private external fun create(symmetricKey: ByteArray, encrypt: Boolean): Long
+
+        @JvmStatic
+        private external fun free(ptr: Long)
+    }
+
+    private var stream: Long? = ptr
+    private val cleanable = NativeCleaner.register(this) { free(ptr) }
+
+    /**
+     * Processes next chunk of data.
+     *
+     * @param chunk next chunk of data
+     * @return processed data, possibly empty
+     * @throws IllegalStateException thrown when instance is closed or finished
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(IllegalStateException::class, NativeException::class)
+    external fun update(chunk: ByteArray): ByteArray
+
+    /**
+     * Processes remaining bytes of [input], advancing its position.
+     * Direct buffers are read in place, without copying them to the Java heap.
+     *
+     * @param input next chunk of data
+     * @return processed data, possibly empty
+     * @throws IllegalStateException thrown when instance is closed or finished
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(IllegalStateException::class, NativeException::class)
+    fun update(input: ByteBuffer): ByteArray {
+        val result = if (input.isDirect) {
+            updateDirect(input, input.position(), input.remaining())
+        } else {
+            update(ByteArray(input.remaining()).also { input.duplicate().get(it) })
+        }
+        input.position(input.limit())
+        return result
+    }
+
+    /**
+     * Processes remaining bytes of [input] and writes result to [output], advancing positions of both.
+     * Both buffers must be direct; data is processed without copying it to the Java heap.
+     * Processing in place is not supported, as output may run ahead of input: the remaining parts
+     * of [input] and [output] must not share memory.
+     *
+     * @param input  next chunk of data
+     * @param output buffer with at least `input.remaining()` + [MAX_UPDATE_OVERHEAD] bytes remaining
+     * @return number of bytes written to [output]
+     * @throws IllegalArgumentException thrown when any of the buffers is not direct or [output] is too small
+     * @throws IllegalStateException    thrown when instance is closed or finished
+     * @throws NativeException          thrown when [input] and [output] overlap or method encounters
+     * an unknown exception
+     */
+    @Throws(IllegalArgumentException::class, IllegalStateException::class, NativeException::class)
+    fun update(input: ByteBuffer, output: ByteBuffer): Int {
+        require(input.isDirect && output.isDirect) { "Input and output must be direct buffers" }
+        require(!output.isReadOnly) { "Output must not be read-only" }
+        require(output.remaining() >= input.remaining() + MAX_UPDATE_OVERHEAD) { "Output buffer is too small" }
+        val written = updateDirectInto(
+            input, input.position(), input.remaining(),
+            output, output.position(), output.remaining()
+        )
+        input.position(input.limit())
+        output.position(output.position() + written)
+        return written
+    }
+
+    /**
+     * Finishes processing. When encrypting, returns the remaining encrypted data including the
+     * authentication tag. When decrypting, verifies the authentication tag and returns empty array.
+     *
+     * @return remaining processed data
+     * @throws IllegalStateException thrown when instance is closed or already finished
+     * @throws NativeException       thrown when decrypted data is corrupted or the key is invalid
+     */
+    @Throws(IllegalStateException::class, NativeException::class)
+    external fun doFinal(): ByteArray
+
+    /**
+     * Frees native memory. Calling this method on a closed instance has no effect.
+     */
+    @Synchronized
+    override fun close() {
+        if (stream != null) {
+            stream = null
+            cleanable.clean()
+        }
+    }
+
+    @Throws(IllegalStateException::class, NativeException::class)
+    private external fun updateDirect(input: ByteBuffer, offset: Int, length: Int): ByteArray
+
+    @Throws(IllegalStateException::class, NativeException::class)
+    private external fun updateDirectInto(
+        input: ByteBuffer,
+        inputOffset: Int,
+        length: Int,
+        output: ByteBuffer,
+        outputOffset: Int,
+        outputLength: Int
+    ): Int
+}
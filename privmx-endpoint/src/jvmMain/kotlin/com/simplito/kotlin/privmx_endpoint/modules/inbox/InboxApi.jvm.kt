@@ -13,15 +13,19 @@ package com.simplito.kotlin.privmx_endpoint.modules.inbox
 
 import com.simplito.kotlin.privmx_endpoint.LibLoader
 import com.simplito.kotlin.privmx_endpoint.model.ContainerPolicyWithoutItem
+import com.simplito.kotlin.privmx_endpoint.model.FieldProjection
 import com.simplito.kotlin.privmx_endpoint.model.FilesConfig
 import com.simplito.kotlin.privmx_endpoint.model.Inbox
 import com.simplito.kotlin.privmx_endpoint.model.InboxEntry
 import com.simplito.kotlin.privmx_endpoint.model.InboxPublicView
+import com.simplito.kotlin.privmx_endpoint.model.LazyInboxEntry
 import com.simplito.kotlin.privmx_endpoint.model.PagingList
 import com.simplito.kotlin.privmx_endpoint.model.UserWithPubKey
 import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
 import com.simplito.kotlin.privmx_endpoint.model.exceptions.PrivmxException
 import com.simplito.kotlin.privmx_endpoint.modules.core.Connection
+import com.simplito.kotlin.privmx_endpoint.modules.core.NativeBuffer
+import com.simplito.kotlin.privmx_endpoint.modules.core.PreparedQuery
 import com.simplito.kotlin.privmx_endpoint.modules.store.StoreApi
 import com.simplito.kotlin.privmx_endpoint.modules.thread.ThreadApi
 
@@ -166,6 +170,31 @@ actual constructor(
         queryAsJson: String?
     ): PagingList<Inbox>
 
+    /**
+     * Gets a list of Inboxes using sort order and filter of a [PreparedQuery].
+     *
+     * @param contextId ID of the Context to get Inboxes from
+     * @param skip      skip number of elements to skip from result
+     * @param limit     limit of elements to return for query
+     * @param query     prepared sort order and filter
+     * @param lastId    ID of the element from which query results should start
+     * @return list of Inboxes
+     * @throws IllegalStateException thrown when instance is closed or [query] is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    fun listInboxes(
+        contextId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String? = null
+    ): PagingList<Inbox> = listInboxesPrepared(
+        contextId, skip, limit, query, lastId
+    )
+
     /**
      * Gets public data of given Inbox.
      * You do not have to be logged in to call this function.
@@ -272,6 +301,169 @@ actual constructor(
         queryAsJson: String?
     ): PagingList<InboxEntry>
 
+    /**
+     * Gets a list of entries using sort order and filter of a [PreparedQuery].
+     *
+     * @param inboxId    ID of the Inbox to list entries from
+     * @param skip       skip number of elements to skip from result
+     * @param limit      limit of elements to return for query
+     * @param query      prepared sort order and filter
+     * @param lastId     ID of the element from which query results should start
+     * @param projection fields of each item to copy; excluded fields are returned empty
+     * @return list of entries
+     * @throws IllegalStateException thrown when instance is closed or [query] is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    fun listEntries(
+        inboxId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String? = null,
+        projection: FieldProjection = FieldProjection.ALL
+    ): PagingList<InboxEntry> = listEntriesPrepared(
+        inboxId, skip, limit, query, lastId, projection.mask
+    )
+
+    /**
+     * Gets a list of entries from an Inbox, keeping entry data and file meta in native memory.
+     *
+     * Payload is copied to the Java heap only for items that access it. Native memory of each item
+     * is released by its `close()` method or after the item is garbage collected.
+     *
+     * @param inboxId     ID of the Inbox to list entries from
+     * @param skip        skip number of elements to skip from result
+     * @param limit       limit of elements to return for query
+     * @param sortOrder   order of elements in result ("asc" for ascending, "desc" for descending)
+     * @param lastId      ID of the element from which query results should start
+     * @param queryAsJson stringified JSON object with a custom field to filter result
+     * @return list of entries with lazily materialized payload
+     * @throws IllegalStateException thrown when instance is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(
+        PrivmxException::class, NativeException::class, IllegalStateException::class
+    )
+    @JvmOverloads
+    external fun listEntriesLazy(
+        inboxId: String,
+        skip: Long,
+        limit: Long,
+        sortOrder: String = "desc",
+        lastId: String? = null,
+        queryAsJson: String? = null
+    ): PagingList<LazyInboxEntry>
+
+    /**
+     * Gets a list of entries with lazily materialized payload using sort order and filter of a [PreparedQuery].
+     *
+     * @param inboxId ID of the Inbox to list entries from
+     * @param skip    skip number of elements to skip from result
+     * @param limit   limit of elements to return for query
+     * @param query   prepared sort order and filter
+     * @param lastId  ID of the element from which query results should start
+     * @return list of entries with lazily materialized payload
+     * @throws IllegalStateException thrown when instance is closed or [query] is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    fun listEntriesLazy(
+        inboxId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String? = null
+    ): PagingList<LazyInboxEntry> = listEntriesLazyPrepared(
+        inboxId, skip, limit, query, lastId
+    )
+
+    /**
+     * Gets an entry, copying only fields selected by [projection].
+     *
+     * @param inboxEntryId ID of an entry to read from the Inbox
+     * @param projection   fields of the entry to copy; excluded fields are returned empty
+     * @return Inbox entry
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(
+        PrivmxException::class, NativeException::class, IllegalStateException::class
+    )
+    fun readEntry(inboxEntryId: String, projection: FieldProjection): InboxEntry =
+        readEntryProjected(inboxEntryId, projection.mask)
+
+    /**
+     * Gets entries with given IDs within a single native call.
+     * Entries are requested concurrently, up to 16 at once.
+     *
+     * @param inboxEntryIds IDs of entries to read from the Inbox
+     * @return entries in the order of [inboxEntryIds]
+     * @throws PrivmxException       thrown when reading any of the entries fails
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(
+        PrivmxException::class, NativeException::class, IllegalStateException::class
+    )
+    external fun readEntries(inboxEntryIds: List<String>): List<InboxEntry>
+
+    /**
+     * Gets entries with given IDs within a single native call, copying only fields selected by [projection].
+     * Entries are requested concurrently, up to 16 at once.
+     *
+     * @param inboxEntryIds IDs of entries to read from the Inbox
+     * @param projection    fields of the entries to copy; excluded fields are returned empty
+     * @return entries in the order of [inboxEntryIds]
+     * @throws PrivmxException       thrown when reading any of the entries fails
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(
+        PrivmxException::class, NativeException::class, IllegalStateException::class
+    )
+    fun readEntries(inboxEntryIds: List<String>, projection: FieldProjection): List<InboxEntry> =
+        readEntriesProjected(inboxEntryIds, projection.mask)
+
+    /**
+     * Gets list of entries of given Inbox, copying only fields selected by [projection].
+     *
+     * Use [FieldProjection.INFO_ONLY] or [FieldProjection.META_ONLY] to avoid copying entry data
+     * when listing large pages.
+     *
+     * @param inboxId     ID of the Inbox
+     * @param skip        skip number of elements to skip from result
+     * @param limit       limit of elements to return for query
+     * @param sortOrder   order of elements in result ("asc" for ascending, "desc" for descending)
+     * @param lastId      ID of the element from which query results should start
+     * @param queryAsJson stringified JSON object with a custom field to filter result
+     * @param projection  fields of each entry to copy; excluded fields are returned empty
+     * @return list of entries
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(
+        PrivmxException::class, NativeException::class, IllegalStateException::class
+    )
+    fun listEntries(
+        inboxId: String,
+        skip: Long,
+        limit: Long,
+        sortOrder: String,
+        lastId: String?,
+        queryAsJson: String?,
+        projection: FieldProjection
+    ): PagingList<InboxEntry> = listEntriesProjected(
+        inboxId, skip, limit, sortOrder, lastId, queryAsJson, projection.mask
+    )
+
     /**
      * Deletes an entry from an Inbox.
      *
@@ -352,6 +544,24 @@ actual constructor(
     )
     actual external fun readFromFile(fileHandle: Long, length: Long): ByteArray
 
+    /**
+     * Reads file data into native memory, without copying it to the Java heap.
+     *
+     * Use [NativeBuffer.asByteBuffer] to pass the chunk on (e.g. to a channel) and close the returned
+     * buffer when it is no longer needed; the view keeps the native memory alive on its own.
+     *
+     * @param fileHandle handle to the file
+     * @param length     size of data to read
+     * @return File data chunk held in native memory
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(
+        PrivmxException::class, NativeException::class, IllegalStateException::class
+    )
+    external fun readFromFileDirect(fileHandle: Long, length: Long): NativeBuffer
+
     /**
      * Moves file's read cursor.
      *
@@ -417,6 +627,19 @@ actual constructor(
     )
     actual external fun subscribeForEntryEvents(inboxId: String)
 
+    /**
+     * Subscribes for events in each of given Inboxes.
+     * Failure for one Inbox does not stop the others.
+     * Requests are sent concurrently within a single native call, up to 16 at once.
+     *
+     * @param inboxIds IDs of the Inboxes to subscribe; duplicated IDs are subscribed once
+     * @return map from IDs of Inboxes that could not be subscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun subscribeForEntryEvents(inboxIds: List<String>): Map<String, Throwable> =
+        subscribeForEntryEventsBulk(inboxIds)
+
     /**
      * Unsubscribes from events in given Inbox.
      *
@@ -430,6 +653,19 @@ actual constructor(
     )
     actual external fun unsubscribeFromEntryEvents(inboxId: String)
 
+    /**
+     * Unsubscribes from events in each of given Inboxes.
+     * Failure for one Inbox does not stop the others.
+     * Requests are sent concurrently within a single native call, up to 16 at once.
+     *
+     * @param inboxIds IDs of the Inboxes to unsubscribe; duplicated IDs are unsubscribed once
+     * @return map from IDs of Inboxes that could not be unsubscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun unsubscribeFromEntryEvents(inboxIds: List<String>): Map<String, Throwable> =
+        unsubscribeFromEntryEventsBulk(inboxIds)
+
     /**
      * Frees memory.
      *
@@ -439,6 +675,63 @@ actual constructor(
         deinit()
     }
 
+    @Throws(
+        PrivmxException::class, NativeException::class, IllegalStateException::class
+    )
+    private external fun readEntryProjected(inboxEntryId: String, fields: Int): InboxEntry
+
+    @Throws(
+        PrivmxException::class, NativeException::class, IllegalStateException::class
+    )
+    private external fun readEntriesProjected(inboxEntryIds: List<String>, fields: Int): List<InboxEntry>
+
+    @Throws(
+        PrivmxException::class, NativeException::class, IllegalStateException::class
+    )
+    private external fun listEntriesProjected(
+        inboxId: String,
+        skip: Long,
+        limit: Long,
+        sortOrder: String,
+        lastId: String?,
+        queryAsJson: String?,
+        fields: Int
+    ): PagingList<InboxEntry>
+
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listInboxesPrepared(
+        contextId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String?
+    ): PagingList<Inbox>
+
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listEntriesPrepared(
+        inboxId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String?,
+        fields: Int
+    ): PagingList<InboxEntry>
+
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listEntriesLazyPrepared(
+        inboxId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String?
+    ): PagingList<LazyInboxEntry>
+
+    @Throws(IllegalStateException::class)
+    private external fun subscribeForEntryEventsBulk(inboxIds: List<String>): Map<String, Throwable>
+
+    @Throws(IllegalStateException::class)
+    private external fun unsubscribeFromEntryEventsBulk(inboxIds: List<String>): Map<String, Throwable>
+
     @Throws(IllegalStateException::class)
     private external fun init(
         connection: Connection,
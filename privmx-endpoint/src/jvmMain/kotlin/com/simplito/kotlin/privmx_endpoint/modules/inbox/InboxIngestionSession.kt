@@ -0,0 +1,156 @@
+//
+// PrivMX Endpoint Kotlin.
+// Copyright © 2025 Simplito sp. z o.o.
+//
+// This file is part of the PrivMX Platform (https://privmx.dev).
+// This software is Licensed under the MIT License.
+//
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.simplito.kotlin.privmx_endpoint.modules.inbox
+
+import com.simplito.kotlin.privmx_endpoint.LibLoader
+import com.simplito.kotlin.privmx_endpoint.NativeCleaner
+import com.simplito.kotlin.privmx_endpoint.model.InboxPublicView
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
+import com.simplito.kotlin.privmx_endpoint.model.exceptions.PrivmxException
+import com.simplito.kotlin.privmx_endpoint.modules.core.CancellationToken
+import java.util.concurrent.CompletableFuture
+
+/**
+ * Sends many entries to a single Inbox, for example from a public intake service.
+ *
+ * Inbox ID, sender key and Inbox public view are read and validated once, when the session is opened,
+ * and kept in native memory for all entries sent within the session.
+ * Entries sent with [sendAsync] run on a native thread pool, so preparing and sending
+ * of consecutive entries overlaps instead of waiting for each other.
+ *
+ * The session shares native Inbox API with [InboxApi] passed to [open]; it remains usable after
+ * that instance is closed, as long as the connection is open.
+ */
+class InboxIngestionSession private constructor(ptr: Long) : AutoCloseable {
+    companion object {
+        init {
+            LibLoader.load()
+        }
+
+        /**
+         * Opens session sending entries to given Inbox.
+         * You do not have to be logged in to call this function.
+         *
+         * @param inboxApi    Inbox API used to send entries
+         * @param inboxId     ID of the Inbox to send entries to
+         * @param userPrivKey sender can optionally provide a private key, which will be used
+         * to sign the sent data and to derive public key sent along with the data
+         * @return session ready to send entries
+         * @throws PrivmxException       thrown when the Inbox cannot be read
+         * @throws NativeException       thrown when method encounters an unknown exception
+         * @throws IllegalStateException thrown when [inboxApi] is closed
+         */
+        @JvmStatic
+        @JvmOverloads
+        @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+        fun open(inboxApi: InboxApi, inboxId: String, userPrivKey: String? = null) =
+            InboxIngestionSession(create(inboxApi, inboxId, userPrivKey))
+
+        @JvmStatic
+        private external fun create(inboxApi: InboxApi, inboxId: String, userPrivKey: String?): Long
+
+        @JvmStatic
+        private external fun free(ptr: Long)
+    }
+
+    private var session: Long? = ptr
+    private val cleanable = NativeCleaner.register(this) { free(ptr) }
+
+    /**
+     * Public view of the Inbox, read when the session was opened.
+     *
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @get:Throws(IllegalStateException::class)
+    val publicView: InboxPublicView
+        get() = getPublicView()
+
+    /**
+     * Prepares an entry with files. Write files with [InboxApi.writeToFile] using returned handle,
+     * then send the entry with [sendEntry] or [sendEntryAsync].
+     *
+     * @param data        entry data to send
+     * @param fileHandles handles of files created with [InboxApi.createFileHandle]
+     * @return Inbox handle
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    external fun prepareEntry(data: ByteArray, fileHandles: LongArray = LongArray(0)): Long
+
+    /**
+     * Sends entry prepared with [prepareEntry].
+     *
+     * @param inboxHandle Inbox handle returned by [prepareEntry]
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun sendEntry(inboxHandle: Long)
+
+    /**
+     * Sends entry prepared with [prepareEntry] asynchronously.
+     * The returned future is completed exceptionally with [PrivmxException] or [NativeException]
+     * when the request fails.
+     *
+     * @param inboxHandle Inbox handle returned by [prepareEntry]
+     * @param token       token cancelling the call, or null
+     * @return future completed when the entry is sent
+     * @throws IllegalStateException thrown when instance or [token] is closed
+     */
+    @Throws(IllegalStateException::class)
+    @JvmOverloads
+    external fun sendEntryAsync(inboxHandle: Long, token: CancellationToken? = null): CompletableFuture<Unit>
+
+    /**
+     * Prepares and sends an entry without files within a single native call.
+     *
+     * @param data entry data to send
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun send(data: ByteArray)
+
+    /**
+     * Prepares and sends an entry without files asynchronously.
+     * The returned future is completed exceptionally with [PrivmxException] or [NativeException]
+     * when the request fails.
+     *
+     * @param data  entry data to send
+     * @param token token cancelling the call, or null
+     * @return future completed when the entry is sent
+     * @throws IllegalStateException thrown when instance or [token] is closed
+     */
+    @Throws(IllegalStateException::class)
+    @JvmOverloads
+    external fun sendAsync(data: ByteArray, token: CancellationToken? = null): CompletableFuture<Unit>
+
+    /**
+     * Frees native memory. Calls in progress complete normally.
+     * Calling this method on a closed instance has no effect.
+     */
+    @Synchronized
+    override fun close() {
+        if (session != null) {
+            session = null
+            cleanable.clean()
+        }
+    }
+
+    @Throws(IllegalStateException::class)
+    private external fun getPublicView(): InboxPublicView
+}
@@ -14,12 +14,17 @@ package com.simplito.kotlin.privmx_endpoint.modules.store
 import com.simplito.kotlin.privmx_endpoint.LibLoader
 import com.simplito.kotlin.privmx_endpoint.model.ContainerPolicy
 import com.simplito.kotlin.privmx_endpoint.model.File
+import com.simplito.kotlin.privmx_endpoint.model.LazyFile
 import com.simplito.kotlin.privmx_endpoint.model.PagingList
 import com.simplito.kotlin.privmx_endpoint.model.Store
 import com.simplito.kotlin.privmx_endpoint.model.UserWithPubKey
 import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
 import com.simplito.kotlin.privmx_endpoint.model.exceptions.PrivmxException
+import com.simplito.kotlin.privmx_endpoint.modules.core.CancellationToken
 import com.simplito.kotlin.privmx_endpoint.modules.core.Connection
+import com.simplito.kotlin.privmx_endpoint.modules.core.NativeBuffer
+import com.simplito.kotlin.privmx_endpoint.modules.core.PreparedQuery
+import java.util.concurrent.CompletableFuture
 
 /**
  * Manages PrivMX Bridge Stores and Files.
@@ -148,6 +153,31 @@ actual constructor(connection: Connection) : AutoCloseable {
         queryAsJson: String?
     ): PagingList<Store>
 
+    /**
+     * Gets a list of Stores using sort order and filter of a [PreparedQuery].
+     *
+     * @param contextId ID of the Context to get the Stores from
+     * @param skip      skip number of elements to skip from result
+     * @param limit     limit of elements to return for query
+     * @param query     prepared sort order and filter
+     * @param lastId    ID of the element from which query results should start
+     * @return list of Stores
+     * @throws IllegalStateException thrown when instance is closed or [query] is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    fun listStores(
+        contextId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String? = null
+    ): PagingList<Store> = listStoresPrepared(
+        contextId, skip, limit, query, lastId
+    )
+
     /**
      * Deletes a Store by given Store ID.
      *
@@ -308,6 +338,88 @@ actual constructor(connection: Connection) : AutoCloseable {
         queryAsJson: String?
     ): PagingList<File>
 
+    /**
+     * Gets a list of files using sort order and filter of a [PreparedQuery].
+     *
+     * @param storeId ID of the Store to list files from
+     * @param skip    skip number of elements to skip from result
+     * @param limit   limit of elements to return for query
+     * @param query   prepared sort order and filter
+     * @param lastId  ID of the element from which query results should start
+     * @return list of files
+     * @throws IllegalStateException thrown when instance is closed or [query] is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    fun listFiles(
+        storeId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String? = null
+    ): PagingList<File> = listFilesPrepared(
+        storeId, skip, limit, query, lastId
+    )
+
+    /**
+     * Gets a list of files from a Store, keeping file meta in native memory.
+     *
+     * Payload is copied to the Java heap only for items that access it. Native memory of each item
+     * is released by its `close()` method or after the item is garbage collected.
+     *
+     * @param storeId     ID of the Store to list files from
+     * @param skip        skip number of elements to skip from result
+     * @param limit       limit of elements to return for query
+     * @param sortOrder   order of elements in result ("asc" for ascending, "desc" for descending)
+     * @param lastId      ID of the element from which query results should start
+     * @param queryAsJson stringified JSON object with a custom field to filter result
+     * @return list of files with lazily materialized payload
+     * @throws IllegalStateException thrown when instance is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(
+        PrivmxException::class,
+        NativeException::class,
+        IllegalStateException::class
+    )
+    @JvmOverloads
+    external fun listFilesLazy(
+        storeId: String,
+        skip: Long,
+        limit: Long,
+        sortOrder: String = "desc",
+        lastId: String? = null,
+        queryAsJson: String? = null
+    ): PagingList<LazyFile>
+
+    /**
+     * Gets a list of files with lazily materialized meta using sort order and filter of a [PreparedQuery].
+     *
+     * @param storeId ID of the Store to list files from
+     * @param skip    skip number of elements to skip from result
+     * @param limit   limit of elements to return for query
+     * @param query   prepared sort order and filter
+     * @param lastId  ID of the element from which query results should start
+     * @return list of files with lazily materialized meta
+     * @throws IllegalStateException thrown when instance is closed or [query] is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    fun listFilesLazy(
+        storeId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String? = null
+    ): PagingList<LazyFile> = listFilesLazyPrepared(
+        storeId, skip, limit, query, lastId
+    )
+
     /**
      * Opens a file to read.
      *
@@ -341,6 +453,47 @@ actual constructor(connection: Connection) : AutoCloseable {
     )
     actual external fun readFromFile(fileHandle: Long, length: Long): ByteArray
 
+    /**
+     * Reads file data asynchronously.
+     *
+     * The request runs on a native thread pool, so the calling thread is not blocked.
+     * The returned future is completed exceptionally with [PrivmxException] or [NativeException]
+     * when the request fails. The instance may be closed while the request is in progress.
+     *
+     * @param fileHandle handle to read file data
+     * @param length     size of data to read
+     * @param token      token cancelling the call, or null
+     * @return future completed with file data chunk
+     * @throws IllegalStateException thrown when instance or [token] is closed
+     */
+    @Throws(IllegalStateException::class)
+    @JvmOverloads
+    external fun readFromFileAsync(
+        fileHandle: Long,
+        length: Long,
+        token: CancellationToken? = null
+    ): CompletableFuture<ByteArray>
+
+    /**
+     * Reads file data into native memory, without copying it to the Java heap.
+     *
+     * Use [NativeBuffer.asByteBuffer] to pass the chunk on (e.g. to a channel) and close the returned
+     * buffer when it is no longer needed; the view keeps the native memory alive on its own.
+     *
+     * @param fileHandle handle to read file data
+     * @param length     size of data to read
+     * @return File data chunk held in native memory
+     * @throws IllegalStateException thrown when instance is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(
+        PrivmxException::class,
+        NativeException::class,
+        IllegalStateException::class
+    )
+    external fun readFromFileDirect(fileHandle: Long, length: Long): NativeBuffer
+
     /**
      * Moves read cursor.
      *
@@ -416,6 +569,19 @@ actual constructor(connection: Connection) : AutoCloseable {
     )
     actual external fun subscribeForFileEvents(storeId: String)
 
+    /**
+     * Subscribes for events in each of given Stores.
+     * Failure for one Store does not stop the others.
+     * Requests are sent concurrently within a single native call, up to 16 at once.
+     *
+     * @param storeIds IDs of the Stores to subscribe; duplicated IDs are subscribed once
+     * @return map from IDs of Stores that could not be subscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun subscribeForFileEvents(storeIds: List<String>): Map<String, Throwable> =
+        subscribeForFileEventsBulk(storeIds)
+
     /**
      * Unsubscribes from events in given Store.
      *
@@ -431,6 +597,52 @@ actual constructor(connection: Connection) : AutoCloseable {
     )
     actual external fun unsubscribeFromFileEvents(storeId: String)
 
+    /**
+     * Unsubscribes from events in each of given Stores.
+     * Failure for one Store does not stop the others.
+     * Requests are sent concurrently within a single native call, up to 16 at once.
+     *
+     * @param storeIds IDs of the Stores to unsubscribe; duplicated IDs are unsubscribed once
+     * @return map from IDs of Stores that could not be unsubscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun unsubscribeFromFileEvents(storeIds: List<String>): Map<String, Throwable> =
+        unsubscribeFromFileEventsBulk(storeIds)
+
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listStoresPrepared(
+        contextId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String?
+    ): PagingList<Store>
+
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listFilesPrepared(
+        storeId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String?
+    ): PagingList<File>
+
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listFilesLazyPrepared(
+        storeId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String?
+    ): PagingList<LazyFile>
+
+    @Throws(IllegalStateException::class)
+    private external fun subscribeForFileEventsBulk(storeIds: List<String>): Map<String, Throwable>
+
+    @Throws(IllegalStateException::class)
+    private external fun unsubscribeFromFileEventsBulk(storeIds: List<String>): Map<String, Throwable>
+
     @Throws(IllegalStateException::class)
     private external fun init(connection: Connection): Long?
 
@@ -13,14 +13,19 @@ package com.simplito.kotlin.privmx_endpoint.modules.thread
 
 import com.simplito.kotlin.privmx_endpoint.LibLoader
 import com.simplito.kotlin.privmx_endpoint.model.ContainerPolicy
+import com.simplito.kotlin.privmx_endpoint.model.FieldProjection
+import com.simplito.kotlin.privmx_endpoint.model.LazyMessage
 import com.simplito.kotlin.privmx_endpoint.model.Message
 import com.simplito.kotlin.privmx_endpoint.model.PagingList
 import com.simplito.kotlin.privmx_endpoint.model.Thread
 import com.simplito.kotlin.privmx_endpoint.model.UserWithPubKey
 import com.simplito.kotlin.privmx_endpoint.model.exceptions.NativeException
 import com.simplito.kotlin.privmx_endpoint.model.exceptions.PrivmxException
+import com.simplito.kotlin.privmx_endpoint.modules.core.CancellationToken
 import com.simplito.kotlin.privmx_endpoint.modules.core.Connection
+import com.simplito.kotlin.privmx_endpoint.modules.core.PreparedQuery
 import java.lang.AutoCloseable
+import java.util.concurrent.CompletableFuture
 
 /**
  * Manages Threads and messages.
@@ -135,6 +140,31 @@ actual constructor(connection: Connection): AutoCloseable {
         queryAsJson: String?
     ): PagingList<Thread>
 
+    /**
+     * Gets a list of Threads using sort order and filter of a [PreparedQuery].
+     *
+     * @param contextId ID of the Context to get the Threads from
+     * @param skip      skip number of elements to skip from result
+     * @param limit     limit of elements to return for query
+     * @param query     prepared sort order and filter
+     * @param lastId    ID of the element from which query results should start
+     * @return list of Threads
+     * @throws IllegalStateException thrown when instance is closed or [query] is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    fun listThreads(
+        contextId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String? = null
+    ): PagingList<Thread> = listThreadsPrepared(
+        contextId, skip, limit, query, lastId
+    )
+
     /**
      * Deletes a Thread by given Thread ID.
      *
@@ -166,6 +196,31 @@ actual constructor(connection: Connection): AutoCloseable {
         data: ByteArray
     ): String
 
+    /**
+     * Sends a message in a Thread asynchronously.
+     *
+     * The request runs on a native thread pool, so the calling thread is not blocked.
+     * The returned future is completed exceptionally with [PrivmxException] or [NativeException]
+     * when the request fails. The instance may be closed while the request is in progress.
+     *
+     * @param threadId    ID of the Thread to send message to
+     * @param publicMeta  public message metadata
+     * @param privateMeta private message metadata
+     * @param data        content of the message
+     * @param token       token cancelling the call, or null
+     * @return future completed with ID of the new message
+     * @throws IllegalStateException thrown when instance or [token] is closed
+     */
+    @Throws(IllegalStateException::class)
+    @JvmOverloads
+    external fun sendMessageAsync(
+        threadId: String,
+        publicMeta: ByteArray,
+        privateMeta: ByteArray,
+        data: ByteArray,
+        token: CancellationToken? = null
+    ): CompletableFuture<String>
+
     /**
      * Gets a message by given message ID.
      *
@@ -203,6 +258,172 @@ actual constructor(connection: Connection): AutoCloseable {
         queryAsJson: String?
     ): PagingList<Message>
 
+    /**
+     * Gets a list of messages from a Thread asynchronously.
+     *
+     * The request runs on a native thread pool, so the calling thread is not blocked.
+     * The returned future is completed exceptionally with [PrivmxException] or [NativeException]
+     * when the request fails. The instance may be closed while the request is in progress.
+     *
+     * @param threadId    ID of the Thread to list messages from
+     * @param skip        skip number of elements to skip from result
+     * @param limit       limit of elements to return for query
+     * @param sortOrder   order of elements in result ("asc" for ascending, "desc" for descending)
+     * @param lastId      ID of the element from which query results should start
+     * @param queryAsJson stringified JSON object with a custom field to filter result
+     * @param token       token cancelling the call, or null
+     * @return future completed with list of messages
+     * @throws IllegalStateException thrown when instance or [token] is closed
+     */
+    @Throws(IllegalStateException::class)
+    @JvmOverloads
+    external fun listMessagesAsync(
+        threadId: String,
+        skip: Long,
+        limit: Long,
+        sortOrder: String = "desc",
+        lastId: String? = null,
+        queryAsJson: String? = null,
+        token: CancellationToken? = null
+    ): CompletableFuture<PagingList<Message>>
+
+    /**
+     * Gets a list of messages using sort order and filter of a [PreparedQuery].
+     *
+     * @param threadId   ID of the Thread to list messages from
+     * @param skip       skip number of elements to skip from result
+     * @param limit      limit of elements to return for query
+     * @param query      prepared sort order and filter
+     * @param lastId     ID of the element from which query results should start
+     * @param projection fields of each item to copy; excluded fields are returned empty
+     * @return list of messages
+     * @throws IllegalStateException thrown when instance is closed or [query] is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    fun listMessages(
+        threadId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String? = null,
+        projection: FieldProjection = FieldProjection.ALL
+    ): PagingList<Message> = listMessagesPrepared(
+        threadId, skip, limit, query, lastId, projection.mask
+    )
+
+    /**
+     * Gets a list of messages from a Thread, keeping data and meta in native memory.
+     *
+     * Payload is copied to the Java heap only for items that access it. Native memory of each item
+     * is released by its `close()` method or after the item is garbage collected.
+     *
+     * @param threadId    ID of the Thread to list messages from
+     * @param skip        skip number of elements to skip from result
+     * @param limit       limit of elements to return for query
+     * @param sortOrder   order of elements in result ("asc" for ascending, "desc" for descending)
+     * @param lastId      ID of the element from which query results should start
+     * @param queryAsJson stringified JSON object with a custom field to filter result
+     * @return list of messages with lazily materialized payload
+     * @throws IllegalStateException thrown when instance is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    external fun listMessagesLazy(
+        threadId: String,
+        skip: Long,
+        limit: Long,
+        sortOrder: String = "desc",
+        lastId: String? = null,
+        queryAsJson: String? = null
+    ): PagingList<LazyMessage>
+
+    /**
+     * Gets a list of messages with lazily materialized payload using sort order and filter of a [PreparedQuery].
+     *
+     * @param threadId ID of the Thread to list messages from
+     * @param skip     skip number of elements to skip from result
+     * @param limit    limit of elements to return for query
+     * @param query    prepared sort order and filter
+     * @param lastId   ID of the element from which query results should start
+     * @return list of messages with lazily materialized payload
+     * @throws IllegalStateException thrown when instance is closed or [query] is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    @JvmOverloads
+    fun listMessagesLazy(
+        threadId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String? = null
+    ): PagingList<LazyMessage> = listMessagesLazyPrepared(
+        threadId, skip, limit, query, lastId
+    )
+
+    /**
+     * Gets a message by given message ID, copying only fields selected by [projection].
+     *
+     * @param messageId  ID of the message to get
+     * @param projection fields of the message to copy; excluded fields are returned empty
+     * @return Message with matching id
+     * @throws IllegalStateException thrown when instance is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    fun getMessage(messageId: String, projection: FieldProjection): Message =
+        getMessageProjected(messageId, projection.mask)
+
+    /**
+     * Gets a message by given message ID, keeping its data and meta in native memory.
+     *
+     * @param messageId ID of the message to get
+     * @return Message with matching id and lazily materialized payload
+     * @throws IllegalStateException thrown when instance is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    external fun getMessageLazy(messageId: String): LazyMessage
+
+    /**
+     * Gets a list of messages from a Thread, copying only fields selected by [projection].
+     *
+     * Use [FieldProjection.INFO_ONLY] or [FieldProjection.META_ONLY] to avoid copying message data
+     * when listing large pages.
+     *
+     * @param threadId    ID of the Thread to list messages from
+     * @param skip        skip number of elements to skip from result
+     * @param limit       limit of elements to return for query
+     * @param sortOrder   order of elements in result ("asc" for ascending, "desc" for descending)
+     * @param lastId      ID of the element from which query results should start
+     * @param queryAsJson stringified JSON object with a custom field to filter result
+     * @param projection  fields of each message to copy; excluded fields are returned empty
+     * @return list of messages
+     * @throws IllegalStateException thrown when instance is closed
+     * @throws PrivmxException       thrown when method encounters an exception
+     * @throws NativeException       thrown when method encounters an unknown exception
+     */
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    fun listMessages(
+        threadId: String,
+        skip: Long,
+        limit: Long,
+        sortOrder: String,
+        lastId: String?,
+        queryAsJson: String?,
+        projection: FieldProjection
+    ): PagingList<Message> = listMessagesProjected(
+        threadId, skip, limit, sortOrder, lastId, queryAsJson, projection.mask
+    )
+
     /**
      * Deletes a message by given message ID.
      *
@@ -264,6 +485,19 @@ actual constructor(connection: Connection): AutoCloseable {
     @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
     actual external fun subscribeForMessageEvents(threadId: String)
 
+    /**
+     * Subscribes for events in each of given Threads.
+     * Failure for one Thread does not stop the others.
+     * Requests are sent concurrently within a single native call, up to 16 at once.
+     *
+     * @param threadIds IDs of the Threads to subscribe; duplicated IDs are subscribed once
+     * @return map from IDs of Threads that could not be subscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun subscribeForMessageEvents(threadIds: List<String>): Map<String, Throwable> =
+        subscribeForMessageEventsBulk(threadIds)
+
     /**
      * Unsubscribes from events in given Thread.
      *
@@ -275,6 +509,19 @@ actual constructor(connection: Connection): AutoCloseable {
     @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
     actual external fun unsubscribeFromMessageEvents(threadId: String)
 
+    /**
+     * Unsubscribes from events in each of given Threads.
+     * Failure for one Thread does not stop the others.
+     * Requests are sent concurrently within a single native call, up to 16 at once.
+     *
+     * @param threadIds IDs of the Threads to unsubscribe; duplicated IDs are unsubscribed once
+     * @return map from IDs of Threads that could not be unsubscribed to the exceptions thrown for them
+     * @throws IllegalStateException thrown when instance is closed
+     */
+    @Throws(IllegalStateException::class)
+    actual fun unsubscribeFromMessageEvents(threadIds: List<String>): Map<String, Throwable> =
+        unsubscribeFromMessageEventsBulk(threadIds)
+
     /**
      * Frees memory.
      *
@@ -284,6 +531,54 @@ actual constructor(connection: Connection): AutoCloseable {
         deinit()
     }
 
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun getMessageProjected(messageId: String, fields: Int): Message
+
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listMessagesProjected(
+        threadId: String,
+        skip: Long,
+        limit: Long,
+        sortOrder: String,
+        lastId: String?,
+        queryAsJson: String?,
+        fields: Int
+    ): PagingList<Message>
+
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listThreadsPrepared(
+        contextId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String?
+    ): PagingList<Thread>
+
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listMessagesPrepared(
+        threadId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String?,
+        fields: Int
+    ): PagingList<Message>
+
+    @Throws(PrivmxException::class, NativeException::class, IllegalStateException::class)
+    private external fun listMessagesLazyPrepared(
+        threadId: String,
+        skip: Long,
+        limit: Long,
+        query: PreparedQuery,
+        lastId: String?
+    ): PagingList<LazyMessage>
+
+    @Throws(IllegalStateException::class)
+    private external fun subscribeForMessageEventsBulk(threadIds: List<String>): Map<String, Throwable>
+
+    @Throws(IllegalStateException::class)
+    private external fun unsubscribeFromMessageEventsBulk(threadIds: List<String>): Map<String, Throwable>
+
     @Throws(IllegalStateException::class)
     private external fun init(connection: Connection): Long?
 